@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../raylib/src/raylib.h"
+#include "SoundCache.h"
 #include <unordered_map>
 #include <string>
 #include <memory>
@@ -53,6 +54,7 @@ private:
     std::unordered_map<std::string, Texture2D> textures;
     std::unordered_map<std::string, std::pair<int, int>> spriteSheetInfo;
     std::unordered_map<std::string, Sound> sounds;
+    SoundCache soundCache;
     std::unordered_map<std::string, Font> fonts;
     std::unordered_map<std::string, std::vector<uint8_t>> levelData;
 };
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "SaveState.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Pieces shared by the on-disk asset caches (FontCache, SoundCache, TextureCache)
+//
+// Every cache file starts with a CacheFile::Header, the cache's own header extends it as its
+// first member. Caches keyed by source file store a SourceStamp per entry: the path hash finds
+// the entry, size and modification time tell whether the source changed since it was cooked.
+namespace CacheFile {
+    constexpr uint64_t HASH_SEED = 0xcbf29ce484222325ull;
+    constexpr size_t DATA_ALIGNMENT = 16;       // Bulk data offsets, keeps SIMD copies aligned
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+    };
+
+    struct SourceStamp {
+        uint64_t pathHash;
+        int64_t modTime;
+        int64_t fileSize;
+
+        bool Matches(const SourceStamp& other) const {
+            return pathHash == other.pathHash && modTime == other.modTime && fileSize == other.fileSize;
+        }
+    };
+
+    // FNV-1a, chain calls starting from HASH_SEED to hash several fields
+    uint64_t HashBytes(uint64_t hash, const void* data, size_t size);
+    uint64_t HashPath(const std::string& path);
+
+    SourceStamp GetSourceStamp(const std::string& filePath);
+
+    constexpr size_t AlignOffset(size_t offset) {
+        return (offset + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1);
+    }
+
+    // Reads a cache header (a struct whose first member is a CacheFile::Header named common)
+    // and checks that the file was written by this cache in this version
+    template <typename T>
+    bool ReadHeader(StateReader& reader, uint32_t magic, uint32_t version, T& header) {
+        return reader.Read(header) && header.common.magic == magic && header.common.version == version;
+    }
+}
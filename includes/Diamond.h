@@ -1,6 +1,7 @@
 #pragma once
 
 #include "raylib.h"
+#include <cstdint>
 
 class Diamond {
 public:
@@ -11,10 +12,22 @@ public:
     void Draw();
     
     bool IsCollected() const { return collected; }
-    void Collect() { collected = true; }
+    void Collect();
+    void SetCollected(bool value) { collected = value; }
     Rectangle GetBounds() const { return collider; }
     Vector2 GetPosition() const { return position; }
     
+    // Save-state support
+    struct SaveData {
+        Vector2 position;
+        float animTime;
+        float sparkleTime;
+        int32_t currentFrame;
+        uint8_t collected;
+    };
+    SaveData GetSaveData() const;
+    void ApplySaveData(const SaveData& data);
+    
 private:
     Vector2 position;
     bool collected;
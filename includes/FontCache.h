@@ -0,0 +1,29 @@
+#pragma once
+
+#include "../raylib/src/raylib.h"
+#include <cstdint>
+#include <string>
+
+// TTF/OTF font loading with parallel glyph rasterization and an on-disk atlas cache
+//
+// The first load of a (font file, size, codepoint set) rasterizes glyphs with stb_truetype
+// on all hardware threads, packs them with GenImageFontAtlas (same settings as raylib's
+// LoadFontEx) and writes the atlas plus glyph metrics to CACHE_DIRECTORY. Later loads read
+// that file in one go and skip rasterization and packing entirely. Cache files are keyed
+// by a hash of the font file contents, the size and the codepoints, so an edited font
+// simply misses the cache.
+class FontCache {
+public:
+    static constexpr const char* CACHE_DIRECTORY = "cache/fonts";
+
+    // codepoints == nullptr loads codepointCount consecutive codepoints from 32 (95 if 0)
+    // threadCount 0 uses all hardware threads
+    static Font LoadFont(const std::string& filePath, int fontSize, const int* codepoints = nullptr, int codepointCount = 0, int threadCount = 0);
+
+private:
+    static uint64_t ComputeKey(const unsigned char* fileData, int dataSize, int fontSize, const int* codepoints, int codepointCount);
+    static std::string GetCachePath(uint64_t key);
+    static bool LoadFromCache(const std::string& cachePath, uint64_t key, Font& font);
+    static void SaveToCache(const std::string& cachePath, uint64_t key, const Image& atlas, const GlyphInfo* glyphs, const Rectangle* recs, int glyphCount, int fontSize, int padding);
+    static GlyphInfo* RasterizeGlyphs(const unsigned char* fileData, int fontSize, const int* codepoints, int codepointCount, int threadCount, int& glyphCount);
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../raylib/src/raylib.h"
+#include <chrono>
+#include <ctime>
+
+// Frame pacing with selectable wait strategy
+//
+// raylib's WaitTime() sleeps for 95% of the remaining frame and busy-waits the rest
+// (SUPPORT_PARTIALBUSY_WAIT_LOOP), which keeps one core hot all day on kiosk units.
+// FramePacer takes over frame timing (raylib's target FPS is disabled) and sleeps
+// until the deadline minus a wake-up slack learned from the oversleep we actually observe.
+class FramePacer {
+public:
+    enum class Mode {
+        BUSY_WAIT,      // Legacy raylib pacing: SetTargetFPS() + partial busy wait
+        PRECISE_SLEEP,  // Sleep until deadline minus adaptive slack, spin only the slack
+        LOW_POWER       // Sleep until deadline minus adaptive slack, never spin
+    };
+
+    FramePacer();
+    ~FramePacer() = default;
+
+    void SetMode(Mode newMode);
+    Mode GetMode() const { return mode; }
+    void SetTargetFPS(int fps);
+    void SetIdleFPS(int fps);
+
+    // Menus and pause screens don't need full frame rate
+    void SetIdle(bool idle) { isIdle = idle; }
+    bool IsIdle() const { return isIdle; }
+
+    // Call once per frame right after EndDrawing()
+    void WaitForNextFrame();
+
+    // Seconds per frame at the current target, idle rate included
+    double GetTargetPeriod() const;
+
+    // Statistics, refreshed once per second
+    float GetCpuUsage() const { return cpuUsage; }                  // Process CPU time / wall time [0..N cores]
+    float GetFrameJitterMs() const { return jitterMs; }             // RMS deviation of frame period from target
+    float GetMaxFrameErrorMs() const { return maxErrorMs; }         // Worst deviation in the last window
+    float GetWakeSlackMs() const { return static_cast<float>(slack*1000.0); }
+
+    void DrawStats(int x, int y, int fontSize) const;
+    static const char* GetModeName(Mode mode);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void SleepUntil(Clock::time_point deadline);
+    void UpdateStats(double framePeriod, double targetPeriod);
+
+    Mode mode;
+    int targetFPS;
+    int idleFPS;
+    int appliedFPS;     // Value last passed to raylib's SetTargetFPS()
+    bool isIdle;
+
+    Clock::time_point nextDeadline;
+    Clock::time_point lastFrameEnd;
+    bool started;
+
+    // Adaptive wake-up slack (seconds), learned from observed oversleep
+    double slack;
+    double oversleepMean;
+    double oversleepDeviation;
+
+    // Statistics window
+    Clock::time_point windowStart;
+    std::clock_t windowCpuStart;
+    double errorSquaredSum;
+    double errorMax;
+    int windowFrames;
+
+    float cpuUsage;
+    float jitterMs;
+    float maxErrorMs;
+};
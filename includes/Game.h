@@ -1,8 +1,15 @@
 #pragma once
 
 #include "../raylib/src/raylib.h"
+#include "FramePacer.h"
+#include "HudLayer.h"
+#include "LevelArena.h"
+#include "LevelPrefetcher.h"
+#include "RewindBuffer.h"
 #include <memory>
 #include <string>
+#include <vector>
+#include <cstdint>
 
 // Forward declarations
 class Player;
@@ -23,6 +30,7 @@ public:
     // Getters
     Player& GetPlayer() const { return *player; }
     Level& GetCurrentLevel() const { return *currentLevel; }
+    FramePacer& GetFramePacer() { return framePacer; }
     
     int GetScore() const { return score; }
     int GetLives() const { return lives; }
@@ -35,6 +43,20 @@ public:
     void CollectDiamond();
     void LoseLife();
     
+    // Save states
+    void SaveStateTo(std::vector<uint8_t>& buffer) const;
+    bool LoadStateFrom(const uint8_t* data, size_t size);
+    void QuickSave();
+    bool QuickLoad();
+    
+    // Rewind (held key steps back one tick per frame)
+    void SetRewinding(bool rewinding) { isRewinding = rewinding; }
+    bool IsRewinding() const { return isRewinding; }
+    
+    // Endless mode: generated levels follow the authored ones
+    void SetEndlessMode(bool endless) { endlessMode = endless; }
+    bool IsEndlessMode() const { return endlessMode; }
+    
     // Constants for key mappings
     static const int KEY_ANY_OK = 0;
     static const int KEY_OK = 1;
@@ -73,12 +95,23 @@ private:
     void Render();
     void Shutdown();
     void LoadResources();
+    void RegisterSoundEffects();
+    void CreateLevel(int levelNumber);
+    void PrefetchNextLevel();
     
     // Game state
     bool isRunning;
     bool isPaused;
+    bool showDebugOverlay;
+    bool isRewinding;
+    bool endlessMode;
+    
+    // Allocation test: frames in a row of unpaused gameplay, allocation-free after the warm-up
+    static constexpr int STEADY_STATE_WARMUP_FRAMES = 60;
+    int steadyFrames;
     std::unique_ptr<GameState> currentState;
     std::unique_ptr<AssetManager> assetManager;
+    FramePacer framePacer;
     
     // Window settings
     const int screenWidth = 240;
@@ -87,7 +120,18 @@ private:
     
     // Game objects
     std::unique_ptr<Player> player;
-    std::unique_ptr<Level> currentLevel;
+    
+    // Levels alternate between two arenas: the current level's and the one the next level is
+    // prefetched into (declared before the levels, which must be destroyed first)
+    LevelArena spareArena;
+    LevelArena* levelArena;
+    LevelArena* prefetchArena;
+    std::unique_ptr<Level, LevelArena::Deleter> currentLevel;
+    LevelPrefetcher prefetcher;
+    
+    // Last in-place restart, shown in the debug overlay
+    size_t restartChunks;
+    float restartMicroseconds;
     
     // Game variables
     int score;
@@ -99,4 +143,13 @@ private:
     int currentSealMoveDirection;
     int sealArrowOffsetX;
     int sealArrowOffsetY;
+    
+    // Quick-save slot
+    std::vector<uint8_t> quickSaveBuffer;
+    
+    // Last 30 seconds of gameplay
+    RewindBuffer rewindBuffer;
+    
+    // Score, diamonds and lives, cached in a render texture
+    HudLayer hud;
 };
\ No newline at end of file
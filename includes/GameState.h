@@ -1,7 +1,10 @@
 #pragma once
 
 #include "raylib.h"
-#include <memory>
+#include "HudLayer.h"
+#include <algorithm>
+#include <cstddef>
+#include <new>
 
 // Forward declarations
 class Game;
@@ -18,6 +21,9 @@ public:
     virtual void Update() = 0;
     virtual void Render() = 0;
     
+    // Idle states (menus, game over) let the frame pacer throttle the frame rate
+    virtual bool IsIdle() const { return false; }
+    
 protected:
     Game* game;
 };
@@ -31,6 +37,7 @@ public:
     void ProcessInput() override;
     void Update(float deltaTime);
     void Render() override;
+    bool IsIdle() const override { return true; }
     
 private:
     int selectedOption;
@@ -55,6 +62,7 @@ private:
     int currentLevel;
     bool levelCompleted;
     float levelCompletedTimer;
+    HudLayer hud;
 };
 
 // Game Over State
@@ -66,6 +74,7 @@ public:
     void ProcessInput() override;
     void Update(float deltaTime);
     void Render() override;
+    bool IsIdle() const override { return true; }
     
 private:
     Rectangle retryButton;
@@ -73,16 +82,44 @@ private:
 };
 
 // State Manager
+//
+// States are constructed in place in two fixed slots, so the state objects themselves never
+// touch the heap. What they own still may: GameplayState's HudLayer holds std::function
+// bindings, whose pointer-sized captures fit the small-object buffer of common standard
+// libraries but are not guaranteed to, and entering a state loads whatever it needs.
+// ChangeState only builds the pending state in the free slot; the switch (Exit, destroy, Enter)
+// happens before the next ProcessInput/Update/Render, so a state can safely request a change
+// from inside its own methods.
 class GameStateManager {
 public:
     explicit GameStateManager(Game* game);
+    ~GameStateManager();
+    
+    template <typename State>
+    void ChangeState() {
+        static_assert(sizeof(State) <= STATE_SLOT_SIZE, "State does not fit in a state slot");
+        static_assert(alignof(State) <= alignof(std::max_align_t), "State is over-aligned");
+        
+        // A second change in the same frame replaces the first one
+        DestroyState(pendingState);
+        GameState* slot = (currentState == SlotAt(0)) ? SlotAt(1) : SlotAt(0);
+        pendingState = new (slot) State(game);
+    }
     
-    void ChangeState(std::unique_ptr<GameState> newState);
     void ProcessInput();
     void Update(float deltaTime);
     void Render();
+    bool IsIdle() const;
     
 private:
+    static constexpr size_t STATE_SLOT_SIZE = std::max({ sizeof(MenuState), sizeof(GameplayState), sizeof(GameOverState) });
+    
+    GameState* SlotAt(int index) { return reinterpret_cast<GameState*>(slots[index]); }
+    void ApplyPendingState();
+    static void DestroyState(GameState*& state);
+    
     Game* game;
-    std::unique_ptr<GameState> currentState;
+    GameState* currentState;
+    GameState* pendingState;
+    alignas(std::max_align_t) unsigned char slots[2][STATE_SLOT_SIZE];
 };
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "../raylib/src/raylib.h"
+
+#if defined(PLATFORM_HEADLESS)
+#include <chrono>
+#include <fstream>
+#include <string>
+
+// Host side of raylib's headless platform (CMake: -DPLATFORM=Headless)
+//
+// The game renders into rlsw with no window and runs on a virtual clock, so a CI job or
+// render farm runs it as fast as the CPU allows while gameplay still sees 60 Hz frame
+// times. Input comes from a replayed automation events file (.rae, recorded in any normal
+// build with raylib's automation API). Captured frames are appended as raw RGBA to one file,
+// Stop() prints the frame size for encoding it:
+//     ffmpeg -f rawvideo -pix_fmt rgba -s <width>x<height> -r 60 -i frames.rgba out.mp4
+class HeadlessHost {
+public:
+    static HeadlessHost& GetInstance();
+
+    // Needs the window (InitWindow) to be initialized
+    bool OpenReplay(const std::string& filePath);
+    bool OpenCapture(const std::string& filePath);
+    void SetFrameLimit(unsigned int frames) { frameLimit = frames; }
+
+    void Start();
+    void Stop();
+
+    unsigned int GetCapturedFrames() const { return capturedFrames; }
+
+private:
+    HeadlessHost();
+    ~HeadlessHost();
+    HeadlessHost(const HeadlessHost&) = delete;
+    HeadlessHost& operator=(const HeadlessHost&) = delete;
+
+    static void OnFrame(unsigned int frame);
+
+    AutomationEventList replay;
+    bool hasReplay;
+    std::ofstream capture;
+    unsigned int frameLimit;    // 0 runs until the game quits
+    unsigned int presentedFrames;
+    unsigned int capturedFrames;
+    int captureWidth;
+    int captureHeight;
+    std::chrono::steady_clock::time_point startTime;
+    bool isRunning;
+};
+#endif
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "../raylib/src/raylib.h"
+#include <functional>
+
+// Cached HUD layer
+//
+// Text widgets bound to integer values (score, lives, diamond counts) are rendered once into
+// a RenderTexture2D. Each frame only the bound values are compared against the cached ones:
+// the texture is re-rendered when one of them changed, otherwise the whole HUD is a single
+// textured quad with no string formatting or glyph lookups.
+// Without render textures (OpenGL 1.1, software renderer) the widgets are drawn directly.
+class HudLayer {
+public:
+    static constexpr int MAX_WIDGETS = 8;
+
+    using Binding = std::function<int()>;
+
+    HudLayer(int width, int height, Color background);
+    ~HudLayer();
+
+    // Label showing one or two bound values through a printf format, i.e. "DIAMONDS: %d/%d"
+    void AddWidget(const char* format, int x, int y, int fontSize, Color color, Binding value, Binding secondValue = nullptr);
+
+    // Re-renders the cache first if any bound value changed
+    void Draw(int x, int y);
+
+    void Invalidate() { isDirty = true; }
+    void Unload();      // Must run before CloseWindow()
+
+    int GetRedrawCount() const { return redrawCount; }
+
+private:
+    HudLayer(const HudLayer&) = delete;
+    HudLayer& operator=(const HudLayer&) = delete;
+
+    bool RefreshValues();
+    bool IsCacheAvailable();            // Creates the render texture on first use
+    void DrawWidgets(int x, int y) const;
+    void Redraw();
+
+    struct Widget {
+        const char* format;
+        int x;
+        int y;
+        int fontSize;
+        Color color;
+        Binding value;
+        Binding secondValue;
+        int cachedValue;
+        int cachedSecondValue;
+    };
+
+    Widget widgets[MAX_WIDGETS];
+    int widgetCount;
+    int width;
+    int height;
+    Color background;
+    RenderTexture2D target;
+    bool isDirty;
+    bool directMode;                    // Render textures unsupported, widgets are drawn every frame
+    int redrawCount;
+};
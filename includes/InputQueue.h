@@ -0,0 +1,98 @@
+#pragma once
+
+#include "../raylib/src/raylib.h"
+#include <bitset>
+
+// Late-latched keyboard input with input-to-present latency measurement
+//
+// By default raylib polls input at the end of EndDrawing(), before the frame wait, so the
+// next tick acts on key state that is up to a frame old. InputQueue switches raylib to
+// manual polling and samples the keyboard in Latch(), called right before the tick, after
+// the frame wait. Every key change seen there becomes a timestamped event in a fixed queue
+// (taps shorter than a frame included, from raylib's key pressed queue), and the tick reads
+// the latched state through IsKeyDown()/IsKeyPressed()/IsKeyReleased().
+//
+// Event timestamps are the poll time, raylib doesn't report when a key actually changed.
+// A key event happened after the previous latch, so present minus previous latch is a hard
+// upper bound for its input-to-present latency; present minus latch is the response time,
+// the part the game controls. Both are recorded per key press in Present(), releases only
+// keep the latched state right.
+class InputQueue {
+public:
+    static InputQueue& GetInstance();
+
+    static constexpr int MAX_KEYS = 512;        // raylib MAX_KEYBOARD_KEYS
+    static constexpr int MAX_EVENTS = 64;       // Per tick, more are dropped (state stays correct)
+
+    struct KeyEvent {
+        int key;
+        bool down;
+        double time;        // Latch time (GetTime() seconds)
+        double earliest;    // Previous latch, the key changed after this
+    };
+
+    // After InitWindow(): EndDrawing() stops polling, Latch() must then run once per frame
+    void Initialize();
+
+    // Polls input and queues the key changes, call right before the simulation tick
+    void Latch();
+
+    // Call right after EndDrawing(), budget is the frame period the response must fit in
+    void Present(double budget);
+
+    // Latched state, stable for the whole tick. A key tapped between two latches is down
+    // for one tick and released on the next, so taps shorter than a frame still register
+    bool IsKeyDown(int key) const { return IsValidKey(key) && (down[key] || pressed[key]); }
+    bool IsKeyPressed(int key) const { return IsValidKey(key) && pressed[key]; }
+    bool IsKeyReleased(int key) const { return IsValidKey(key) && released[key]; }
+
+    // Key events of the current tick, in arrival order
+    int GetEventCount() const { return eventCount; }
+    const KeyEvent& GetEvent(int index) const { return events[index]; }
+
+    // Statistics: window values refreshed once per second, the rest since Initialize()
+    float GetResponseMs() const { return responseMs; }                  // Mean latch to present
+    float GetMaxResponseMs() const { return maxResponseMs; }
+    float GetWorstLatencyMs() const { return worstLatencyMs; }          // Max input-to-present bound
+    unsigned int GetActionCount() const { return actionCount; }
+    unsigned int GetOverBudgetCount() const { return overBudgetCount; } // Responses longer than a frame
+    unsigned int GetDroppedCount() const { return droppedCount; }
+
+    void DrawStats(int x, int y, int fontSize) const;
+    void PrintReport() const;
+
+private:
+    InputQueue();
+
+    static bool IsValidKey(int key) { return key > 0 && key < MAX_KEYS; }
+    void PushEvent(int key, bool isDown);
+
+    std::bitset<MAX_KEYS> down;
+    std::bitset<MAX_KEYS> pressed;
+    std::bitset<MAX_KEYS> released;
+    std::bitset<MAX_KEYS> pendingRelease;  // Taps already up again, released on the next latch
+
+    KeyEvent events[MAX_EVENTS];
+    int eventCount;
+    double latchTime;
+    double previousLatchTime;
+
+    // Statistics window
+    double windowStart;
+    double responseSum;
+    double responseMax;
+    double latencyMax;
+    int windowActions;
+
+    float responseMs;
+    float maxResponseMs;
+    float worstLatencyMs;
+
+    // Session totals
+    double sessionResponseSum;
+    double sessionResponseMax;
+    double sessionLatencyMax;
+    unsigned int actionCount;
+    unsigned int overBudgetCount;
+    unsigned int droppedCount;
+};
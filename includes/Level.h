@@ -3,15 +3,24 @@
 #include "raylib.h"
 #include "Player.h"
 #include "Diamond.h"
+#include "LevelArena.h"
+#include "LevelGenerator.h"
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <string>
 
+class StateWriter;
+class StateReader;
+
 // Define tile size constant
 constexpr int TILE_SIZE = 16;
 
-// Tile types for Diamond Rush
-enum class TileType {
+// Hand-made levels, later level numbers are generated (endless mode)
+constexpr int AUTHORED_LEVEL_COUNT = 3;
+
+// Tile types for Diamond Rush (one byte each, the tile grid is saved and copied as raw bytes)
+enum class TileType : uint8_t {
     EMPTY,
     WALL,
     DIRT,
@@ -25,6 +34,7 @@ enum class TileType {
 class Level {
 public:
     Level(int levelNumber);
+    Level(int levelNumber, const LevelGenerator::Settings& settings);
     ~Level() = default;
     
     void Update();
@@ -33,26 +43,63 @@ public:
     
     // Getters
     int GetDiamondCount() const { return diamonds.size(); }
+    Vector2 GetDiamondPosition(int index) const { return diamonds[index].GetPosition(); }
     int GetRemainingDiamonds() const;
     Vector2 GetPlayerStartPosition() const { return playerStartPosition; }
     bool IsExitReached() const { return exitReached; }
     bool IsLevelComplete() const { return GetRemainingDiamonds() == 0 && exitReached; }
+    int GetWidth() const { return width; }
+    int GetHeight() const { return height; }
     
     // Level manipulation
     TileType GetTileAt(int x, int y) const;
     void SetTileAt(int x, int y, TileType type);
     void BreakTile(int x, int y);
     
+    // Save-state support
+    void Serialize(StateWriter& writer) const;
+    bool Deserialize(StateReader& reader);
+    
+    // Rewind support: raw tile grid (width * height, row-major) and one bit per diamond
+    // Writes through the mutable grid can't be tracked, the next Restart() copies it all back
+    const TileType* GetTileData() const { return tiles.data(); }
+    TileType* GetTileData() { MarkAllTilesDirty(); return tiles.data(); }
+    void GetDiamondCollectedBits(uint8_t* bits) const;
+    void SetDiamondCollectedBits(const uint8_t* bits);
+    void SetExitReached(bool reached) { exitReached = reached; }
+    
+    // Restart support: the state right after the level build is kept next to the live one.
+    // Restart() copies back only the tile chunks written since then plus the diamond table,
+    // so retrying costs the tiles gameplay changed, not the map size. Returns the chunks copied.
+    bool CanRestart() const { return hasPristineState; }
+    size_t Restart();
+    
 private:
     void LoadLevel(int levelNumber);
     void LoadFromFile(const std::string& filename);
     void CreateTestLevel();
+    void Generate(const LevelGenerator::Settings& settings);
+    void CapturePristineState();
+    void MarkTileDirty(int index);
+    void MarkAllTilesDirty();
+    
+    // Tiles per dirty-tracking chunk, a row-major run of the grid
+    static constexpr int TILE_CHUNK_SIZE = 256;
     
     int levelNumber;
     int width;
     int height;
-    std::vector<TileType> tiles;
-    std::vector<std::unique_ptr<Diamond>> diamonds;
+    // Level-lifetime storage, released in bulk when the next level loads
+    ArenaVector<TileType> tiles;
+    ArenaVector<Diamond> diamonds;
+    
+    // Initial state for Restart(), and the chunks of tiles written since it was captured
+    ArenaVector<TileType> pristineTiles;
+    ArenaVector<Diamond> pristineDiamonds;
+    ArenaVector<uint8_t> chunkDirty;
+    ArenaVector<uint32_t> dirtyChunks;
+    bool allTilesDirty;
+    bool hasPristineState;
     
     Vector2 playerStartPosition;
     Vector2 exitPosition;
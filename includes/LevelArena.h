@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Level-lifetime bump allocator
+//
+// Everything a level owns (the Level itself, its tile grid, diamonds and containers) is carved
+// out of this arena and released all at once by Reset() when the next level loads; individual
+// deallocations are no-ops. A level that outgrows the current block chains on overflow chunks,
+// and the next Reset() folds them into one block sized for the high-water mark, so after the
+// first loads a level change reuses the same memory and gameplay frames never hit the heap.
+//
+// An arena is used by one thread at a time. GetInstance() is the arena level containers
+// allocate from on the calling thread: the default one, unless a Scope routes them to another
+// arena (the next level is prefetched into a second arena on a background thread).
+class LevelArena {
+public:
+    static LevelArena& GetInstance();
+
+    static constexpr size_t DEFAULT_CAPACITY = 256 * 1024;
+
+    explicit LevelArena(size_t capacity = DEFAULT_CAPACITY);
+
+    // Makes arena this thread's GetInstance() for the lifetime of the scope
+    class Scope {
+    public:
+        explicit Scope(LevelArena& arena);
+        ~Scope();
+
+    private:
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        LevelArena* previous;
+    };
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    // Construct an object in the arena; destroy it with LevelArena::Deleter (runs the destructor only)
+    template <typename T, typename... Args>
+    T* Create(Args&&... args) {
+        return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    struct Deleter {
+        template <typename T>
+        void operator()(T* object) const { object->~T(); }
+    };
+
+    // Invalidates every allocation made since the last reset
+    void Reset();
+
+    size_t GetUsed() const { return used; }
+    size_t GetCapacity() const;
+    size_t GetHighWaterMark() const { return highWaterMark; }
+    size_t GetResetCount() const { return resetCount; }
+
+private:
+    LevelArena(const LevelArena&) = delete;
+    LevelArena& operator=(const LevelArena&) = delete;
+
+    void AddChunk(size_t size);
+
+    struct Chunk {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+    };
+
+    std::vector<Chunk> chunks;      // Allocation happens in the last chunk
+    size_t offset;                  // Bump offset in the last chunk
+    size_t used;                    // Bytes handed out since the last reset, padding included
+    size_t highWaterMark;
+    size_t resetCount;
+};
+
+// STL allocator backed by a level arena, the calling thread's current one when constructed
+// (containers keep allocating from the arena their object was built in)
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator() : arena(&LevelArena::GetInstance()) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(arena->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) {
+        // Freed in bulk by LevelArena::Reset()
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const { return arena == other.arena; }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return arena != other.arena; }
+
+private:
+    template <typename U>
+    friend class ArenaAllocator;
+
+    LevelArena* arena;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class TileType : uint8_t;
+
+// Seeded procedural level generator
+//
+// Builds cavern levels of any size up to MAX_SIZE x MAX_SIZE. The map is split into
+// REGION_SIZE square regions (a narrower remainder joins the last row or column) generated in parallel. Nothing depends on thread scheduling:
+// terrain comes from value noise over global coordinates, every region draws from its own
+// random stream derived from (seed, region), and the tunnels connecting neighbouring regions
+// cross each seam at a point derived from (seed, seam), so both sides always agree.
+// Random streams use rprand's generator (Xoshiro128** seeded through SplitMix64).
+class LevelGenerator {
+public:
+    static constexpr int MAX_SIZE = 8192;
+    static constexpr int MIN_SIZE = 8;
+    static constexpr int REGION_SIZE = 256;
+
+    struct Settings {
+        uint64_t seed = 0;
+        int width = 64;
+        int height = 48;
+        float caveDensity = 0.48f;          // Fraction of the noise range carved out as open cavern
+        float diamondDensity = 0.004f;      // Chances per open floor cell
+        float rockDensity = 0.03f;
+        float spikeDensity = 0.01f;
+        float ladderDensity = 0.25f;        // Chance per ledge above a vertical drop
+        float breakableDensity = 0.05f;     // Chance per wall cell bordering the cavern
+        int threadCount = 0;                // 0 uses all hardware threads
+    };
+
+    struct Output {
+        int width = 0;
+        int height = 0;
+        std::vector<TileType> tiles;        // Row-major, width * height
+        std::vector<int> diamondCells;      // Cell indices, ordered by region
+        int startCell = 0;
+        int exitCell = 0;
+    };
+
+    // Settings for endless mode: size and hazards grow with the level number
+    static Settings GetEndlessSettings(int levelNumber);
+
+    static void Generate(const Settings& settings, Output& output);
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "LevelArena.h"
+#include <atomic>
+#include <thread>
+
+class Level;
+
+// Builds the next level on a background thread while the current one is played
+//
+// Level data lives in a LevelArena that is reset when a level loads, so the prefetched level
+// is built in an arena of its own, which the caller hands in and must not touch until the
+// level is taken or the prefetch cancelled. At the transition Game swaps the finished level in
+// and gives the previous level's arena to the next prefetch, the two arenas alternate.
+class LevelPrefetcher {
+public:
+    LevelPrefetcher();
+    ~LevelPrefetcher();
+
+    // Cancels any earlier prefetch first
+    void Start(int levelNumber, LevelArena& arena);
+
+    // Waits for the build if it is still running; nullptr when levelNumber wasn't prefetched.
+    // The level belongs to the caller afterwards (destroy it with LevelArena::Deleter)
+    Level* Take(int levelNumber);
+
+    // Waits for the build and destroys its level
+    void Cancel();
+
+    int GetLevelNumber() const { return levelNumber; }
+    bool IsReady() const { return ready.load(std::memory_order_acquire); }
+
+    // Taken levels: the last build time, whether its transition had to wait, and totals
+    double GetLastBuildTimeMs() const { return lastBuildTimeMs; }
+    bool WasLastTakeWaited() const { return lastTakeWaited; }
+    unsigned int GetTakeCount() const { return takeCount; }
+    unsigned int GetWaitCount() const { return waitCount; }     // Transitions that waited for the build
+
+private:
+    LevelPrefetcher(const LevelPrefetcher&) = delete;
+    LevelPrefetcher& operator=(const LevelPrefetcher&) = delete;
+
+    void Build();
+
+    std::thread worker;
+    LevelArena* arena;
+    Level* level;               // Written by the worker, read after joining it
+    int levelNumber;            // 0 when nothing is prefetched
+    double buildTimeMs;         // Written by the worker, copied to lastBuildTimeMs by Take()
+    std::atomic<bool> ready;
+
+    double lastBuildTimeMs;
+    bool lastTakeWaited;
+    unsigned int takeCount;
+    unsigned int waitCount;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Level.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Offline level solvability checker
+//
+// Breadth-first search over the puzzle state space of a Level: player cell, rock positions,
+// dug DIRT, broken BREAKABLE tiles and collected diamonds. Each BFS layer is expanded in
+// parallel; states are identified by a Zobrist hash and deduplicated in a lock-free shared
+// transposition table (open addressing, CAS insert). Because the search is layered, the
+// first goal found is a solution with the minimal number of moves.
+//
+// Grid rules (one move = one step in a direction):
+//   EMPTY, LADDER, EXIT   walkable
+//   DIRT                  dug out (becomes EMPTY) and entered
+//   BREAKABLE             broken (becomes EMPTY), the player stays in place
+//   ROCK                  pushed one cell if the cell behind it is free and holds no diamond
+//   WALL, SPIKES          blocked
+// The level is solved when every diamond is collected and the player stands on the EXIT.
+class LevelSolver {
+public:
+    enum class Move : uint8_t {
+        UP,
+        RIGHT,
+        DOWN,
+        LEFT
+    };
+
+    enum class Status {
+        SOLVABLE,
+        UNSOLVABLE,
+        LIMIT_REACHED     // State limit hit before the search space was exhausted
+    };
+
+    struct Result {
+        Status status;
+        int moveCount;                  // Minimal number of moves (SOLVABLE only)
+        std::vector<Move> solution;     // Example solution replay (SOLVABLE only)
+        size_t statesExplored;
+        double seconds;
+    };
+
+    explicit LevelSolver(const Level& level);
+
+    // threadCount 0 uses all hardware threads
+    Result Solve(int threadCount = 0, size_t maxStates = 1 << 22);
+
+    static const char* GetStatusName(Status status);
+    static std::string GetSolutionString(const std::vector<Move>& solution);
+
+private:
+    struct Successor {
+        uint64_t hash;
+        uint32_t parent;
+        Move move;
+        bool isGoal;
+    };
+
+    bool IsGoal(const uint32_t* state) const;
+    bool IsFreeCell(const uint32_t* state, int cell) const;
+    int FindRock(const uint32_t* state, int cell) const;
+    bool TestBit(const uint32_t* state, int bit) const;
+    void FlipBit(uint32_t* state, int bit, uint64_t& hash) const;
+    bool ApplyMove(const uint32_t* state, uint64_t hash, Move move, uint32_t* next, uint64_t& nextHash) const;
+    uint64_t ComputeHash(const uint32_t* state) const;
+
+    int width;
+    int height;
+    std::vector<TileType> baseTiles;    // Static tiles, rocks removed
+    std::vector<int> diamondBit;        // Per cell: bit index of the diamond, or -1
+    std::vector<int> dirtBit;           // Per cell: bit index of the DIRT tile, or -1
+    std::vector<int> breakableBit;      // Per cell: bit index of the BREAKABLE tile, or -1
+    int diamondCount;
+    int rockCount;
+    int bitCount;
+
+    // State layout (32-bit words): player cell, sorted rock cells, bitset (diamonds, dirt, breakable)
+    int stateWords;
+    std::vector<uint32_t> initialState;
+
+    // Zobrist keys
+    std::vector<uint64_t> playerKeys;
+    std::vector<uint64_t> rockKeys;
+    std::vector<uint64_t> bitKeys;
+};
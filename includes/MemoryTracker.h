@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Subsystems allocations are charged to (the innermost MemoryScope wins)
+enum class MemoryTag : uint8_t {
+    UNTAGGED,
+    ASSETS,
+    LEVEL,
+    GAME_STATE,
+    AUDIO,
+    PREFETCH,       // Background level builds, not counted against steady-state frames
+    COUNT
+};
+
+// Opt-in allocation tracker
+//
+// Built with TRACK_ALLOCATIONS (cmake -DTRACK_ALLOCATIONS=ON), the global operator new/delete
+// and raylib's RL_MALLOC/RL_FREE hooks (RL_MEMORY_HOOKS) prefix every block with a small
+// header holding its size and tag, so each free is charged back to the subsystem that made
+// the allocation. Without the flag nothing is replaced and all counters stay at zero.
+//
+// Strict mode is the allocation test: the first steady-state frame that allocates is
+// reported with its per-subsystem breakdown and HasFailed() turns true.
+class MemoryTracker {
+public:
+    static MemoryTracker& GetInstance();
+
+    struct TagStats {
+        int64_t liveBytes;
+        int64_t peakBytes;
+        uint64_t totalAllocations;
+        uint32_t frameAllocations;      // Last finished frame
+        uint32_t peakFrameAllocations;
+    };
+
+    static bool IsEnabled();
+    static const char* GetTagName(MemoryTag tag);
+
+    // Frame bracketing; steadyState marks frames that are expected not to allocate.
+    // EndFrame() starts the next frame by itself, BeginFrame() only drops allocations
+    // made since then (loading work outside the frame loop)
+    void BeginFrame();
+    void EndFrame(bool steadyState);
+
+    void SetStrictMode(bool strict) { strictMode = strict; }
+    bool IsStrictMode() const { return strictMode; }
+    bool HasFailed() const { return failed; }
+
+    TagStats GetStats(MemoryTag tag) const;
+    uint32_t GetFrameAllocations() const { return lastFrameAllocations; }
+    uint32_t GetPeakFrameAllocations() const { return peakFrameAllocations; }
+    int64_t GetLiveBytes() const;
+    int64_t GetPeakBytes() const { return peakBytes.load(std::memory_order_relaxed); }
+
+    void DrawStats(int x, int y, int fontSize) const;
+    void PrintReport() const;
+
+    // Called by the allocation hooks, must not allocate
+    void RecordAllocation(MemoryTag tag, size_t size);
+    void RecordFree(MemoryTag tag, size_t size);
+
+    // Called by LevelArena::Reset() when overflow chunks were folded into a bigger block
+    void RecordArenaGrowth(size_t capacity);
+
+private:
+    MemoryTracker() = default;
+    MemoryTracker(const MemoryTracker&) = delete;
+    MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+    struct TagCounters {
+        std::atomic<int64_t> liveBytes{0};
+        std::atomic<int64_t> peakBytes{0};
+        std::atomic<uint64_t> totalAllocations{0};
+        std::atomic<uint32_t> frameAllocations{0};
+        uint32_t lastFrameAllocations = 0;
+        uint32_t peakFrameAllocations = 0;
+    };
+
+    TagCounters tags[static_cast<int>(MemoryTag::COUNT)];
+    std::atomic<int64_t> liveBytes{0};
+    std::atomic<int64_t> peakBytes{0};
+    uint32_t lastFrameAllocations = 0;
+    uint32_t peakFrameAllocations = 0;
+    uint64_t frameNumber = 0;
+    std::atomic<uint32_t> arenaGrowths{0};
+    std::atomic<int64_t> arenaCapacity{0};     // Largest level arena after growing
+    bool strictMode = false;
+    bool failed = false;
+};
+
+// Charges allocations on this thread to a subsystem for the lifetime of the scope
+class MemoryScope {
+public:
+    explicit MemoryScope(MemoryTag tag);
+    ~MemoryScope();
+
+    static MemoryTag GetCurrentTag();
+
+private:
+    MemoryScope(const MemoryScope&) = delete;
+    MemoryScope& operator=(const MemoryScope&) = delete;
+
+    MemoryTag previousTag;
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../raylib/src/raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Pooled particle system
+//
+// Particles are stored structure-of-arrays in pools preallocated at startup, so emitting,
+// integrating and killing particles never allocates. Integration runs 4 particles per
+// iteration (SSE2/NEON, scalar fallback), dead particles are compacted with swap-remove
+// and all live particles are submitted in one batched quad draw.
+class ParticleSystem {
+public:
+    static ParticleSystem& GetInstance();
+
+    static constexpr size_t DEFAULT_CAPACITY = 131072;
+
+    // Emitter settings for a single burst
+    struct Burst {
+        int count;
+        Color color;
+        float speed;        // Max initial speed (pixels/second)
+        float lifeTime;     // Max lifetime (seconds)
+        float size;         // Quad size (pixels)
+        float gravity;      // Vertical acceleration (pixels/second^2)
+    };
+
+    // Presets used by gameplay emitters
+    static const Burst DEBRIS_DIRT;
+    static const Burst DEBRIS_BREAKABLE;
+    static const Burst SPARKLE_DIAMOND;
+    static const Burst HIT_PLAYER;
+
+    void Emit(Vector2 position, const Burst& burst);
+    void Update(float deltaTime);
+    void Draw() const;
+    void Clear();
+
+    size_t GetLiveCount() const { return count; }
+    size_t GetCapacity() const { return capacity; }
+
+private:
+    explicit ParticleSystem(size_t capacity);
+    ParticleSystem(const ParticleSystem&) = delete;
+    ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+    void Integrate(float deltaTime);
+    void Compact();
+    float RandomFloat();    // [0, 1)
+
+    size_t capacity;
+    size_t count;
+    uint32_t randomState;
+
+    // Structure-of-arrays pools (all sized to capacity once)
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> accY;
+    std::vector<float> life;
+    std::vector<float> invLifeTime;
+    std::vector<float> size;
+    std::vector<Color> color;
+};
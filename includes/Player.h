@@ -2,6 +2,7 @@
 
 #include "raylib.h"
 #include "GameObject.h"
+#include <cstdint>
 
 class Player {
 public:
@@ -51,6 +52,20 @@ public:
     int GetDiamondCount() const { return diamondCount; }
     void Reset(float x, float y);
     
+    // Save-state support
+    struct SaveData {
+        Vector2 position;
+        Vector2 velocity;
+        float frameCounter;
+        int32_t currentFrame;
+        int32_t diamondCount;
+        int32_t lives;
+        State state;
+        Direction direction;
+    };
+    SaveData GetSaveData() const;
+    void ApplySaveData(const SaveData& data);
+    
 private:
     // Position and movement
     Vector2 position;
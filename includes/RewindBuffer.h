@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Player.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Level;
+
+// Gameplay rewind buffer
+//
+// Keeps the last N seconds of per-tick world states in fixed-size rings: an entry ring
+// (one slot per tick) and a byte ring holding the encoded payloads. Every KEYFRAME_INTERVAL
+// ticks the tile grid is stored run-length encoded; the ticks in between store the XOR of
+// the grid against that keyframe, run-length encoded, which is a handful of bytes because
+// tiles rarely change. Player state, counters and one bit per diamond are stored verbatim.
+// When either ring is full the oldest keyframe segment is dropped as a whole.
+class RewindBuffer {
+public:
+    static constexpr int KEYFRAME_INTERVAL = 180;  // Ticks between keyframes (3 seconds at 60 Hz)
+
+    // Game counters captured with each tick
+    struct Counters {
+        int32_t score;
+        int32_t lives;
+        int32_t collectedDiamonds;
+        uint8_t exitReached;
+    };
+
+    RewindBuffer(float seconds = 30.0f, int tickRate = 60, size_t byteBudget = 3 * 1024 * 1024);
+
+    void Clear();
+
+    // Store the state at the end of the current tick
+    void Record(const Level& level, const Player::SaveData& player, const Counters& counters);
+
+    // Drop the newest state and restore the one before it, returns false when nothing is left
+    bool StepBack(Level& level, Player::SaveData& player, Counters& counters);
+
+    size_t GetFrameCount() const { return count; }
+    float GetSecondsAvailable() const { return count > 0 ? (count - 1) / static_cast<float>(tickRate) : 0.0f; }
+    size_t GetMemoryUsage() const;
+
+private:
+    struct Entry {
+        uint64_t keyframeSeq;   // Sequence number of the keyframe this entry is encoded against
+        uint32_t offset;        // Payload offset in the byte ring
+        uint32_t size;          // Payload size
+        int32_t width;
+        int32_t height;
+        uint32_t diamondCount;
+    };
+
+    Entry& EntryAt(uint64_t seq) { return entries[seq % entries.size()]; }
+    const Entry& EntryAt(uint64_t seq) const { return entries[seq % entries.size()]; }
+    uint8_t* Allocate(size_t maxSize);
+    void EvictOldestSegment();
+    void LoadKeyframeGrid(uint64_t keyframeSeq);
+    size_t GetPayloadHeaderSize(uint32_t diamondCount) const;
+
+    int tickRate;
+    std::vector<Entry> entries;
+    std::vector<uint8_t> storage;
+    size_t storageHead;     // Next write offset in the byte ring
+
+    uint64_t oldestSeq;
+    uint64_t nextSeq;
+    size_t count;
+
+    // Decoded tile grid of keyframe gridSeq, base for encoding and decoding deltas
+    std::vector<uint8_t> keyframeGrid;
+    uint64_t keyframeGridSeq;
+    std::vector<uint8_t> deltaScratch;
+    bool oversizedWarned;
+};
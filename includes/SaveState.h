@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Save-state buffer format
+//
+// A save state is one flat byte buffer: a SaveStateHeader followed by the Game, Player and
+// Level sections written back to back. The buffer holds no pointers, only plain values and
+// counts, so it can be copied, stored or sent anywhere and restored with a few memcpy calls.
+// Values use native byte order; save states are meant for the machine that wrote them.
+namespace SaveState {
+    constexpr uint32_t MAGIC = 0x53524444;     // "DDRS"
+    constexpr uint32_t VERSION = 1;
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t size;          // Total buffer size including this header
+        uint32_t reserved;
+    };
+}
+
+// Appends plain values to a save-state buffer
+class StateWriter {
+public:
+    explicit StateWriter(std::vector<uint8_t>& buffer) : buffer(buffer) {}
+
+    template <typename T>
+    void Write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Save-state values must be trivially copyable");
+        WriteBytes(&value, sizeof(T));
+    }
+
+    void WriteBytes(const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    size_t GetSize() const { return buffer.size(); }
+
+private:
+    std::vector<uint8_t>& buffer;
+};
+
+// Reads plain values back from a save-state buffer, every read is bounds checked
+class StateReader {
+public:
+    StateReader(const uint8_t* data, size_t size) : data(data), size(size), offset(0) {}
+
+    template <typename T>
+    bool Read(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Save-state values must be trivially copyable");
+        return ReadBytes(&value, sizeof(T));
+    }
+
+    bool ReadBytes(void* destination, size_t count) {
+        if (count > size - offset) return false;
+        memcpy(destination, data + offset, count);
+        offset += count;
+        return true;
+    }
+
+    bool Skip(size_t count) {
+        if (count > size - offset) return false;
+        offset += count;
+        return true;
+    }
+
+    size_t GetRemaining() const { return size - offset; }
+
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+};
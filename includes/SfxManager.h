@@ -0,0 +1,104 @@
+#pragma once
+
+#include "../raylib/src/raylib.h"
+#include <atomic>
+#include <cstdint>
+
+// Gameplay sound effects
+enum class SfxId {
+    DIAMOND_COLLECT,
+    LEVEL_COMPLETE,
+    JUMP,
+    DAMAGE,
+    COUNT
+};
+
+// Polyphonic SFX voice pool
+//
+// Every registered sound gets maxInstances voices up front (LoadSoundAlias over the
+// AssetManager sound), so repeated triggers layer instead of restarting one buffer.
+// Play() only culls inaudible sounds and pushes a trigger into a fixed ring buffer: no
+// locks, no allocations. Update() drains the ring once per frame and assigns voices.
+// When a sound is out of instances, or MAX_ACTIVE_VOICES are playing, a voice is stolen:
+// the lowest priority one that is not above the new sound's priority, quietest first,
+// then oldest. A trigger with nothing to steal is dropped.
+class SfxManager {
+public:
+    static SfxManager& GetInstance();
+
+    static constexpr int MAX_VOICES = 32;           // Preallocated aliases across all sounds
+    static constexpr int MAX_ACTIVE_VOICES = 16;    // Simultaneously playing voices
+    static constexpr int TRIGGER_QUEUE_SIZE = 64;   // Power of two
+    static constexpr float MIN_AUDIBLE_VOLUME = 0.02f;
+
+    struct Settings {
+        int priority;       // Higher steals lower
+        int maxInstances;   // Voices reserved for this sound
+        float volume;
+        float maxDistance;  // Silent beyond this distance (pixels), 0 plays at full volume anywhere
+    };
+
+    // Load time only (allocates the sound's voices)
+    bool Register(SfxId id, Sound source, const Settings& settings);
+    void Unload();          // Must run before the source sounds are unloaded
+
+    // Lock-free and allocation-free, single producer (game thread)
+    bool Play(SfxId id);
+    bool Play(SfxId id, Vector2 position);
+    void SetListener(Vector2 position) { listener = position; }
+
+    // Once per frame: retires finished voices and starts queued triggers
+    void Update();
+    void StopAll();
+
+    int GetActiveVoices() const { return activeVoices; }
+    uint32_t GetStolenCount() const { return stolenCount; }
+    uint32_t GetCulledCount() const { return culledCount; }
+    uint32_t GetDroppedCount() const { return droppedCount; }
+
+private:
+    SfxManager();
+    SfxManager(const SfxManager&) = delete;
+    SfxManager& operator=(const SfxManager&) = delete;
+
+    struct SoundSlot {
+        bool registered;
+        Settings settings;
+        int firstVoice;
+    };
+
+    struct Voice {
+        Sound alias;
+        int sound;          // Owning SfxId
+        float volume;       // Volume it was started with
+        uint32_t sequence;  // Start order, lower is older
+        bool active;
+    };
+
+    struct Trigger {
+        int sound;
+        float volume;
+        float pan;
+    };
+
+    bool Push(const Trigger& trigger);
+    void Start(const Trigger& trigger);
+    int FindVictim(int first, int last, int priority) const;
+    void StopVoice(Voice& voice);
+
+    SoundSlot sounds[static_cast<int>(SfxId::COUNT)];
+    Voice voices[MAX_VOICES];
+    int voiceCount;
+    int activeVoices;
+    uint32_t sequence;
+    Vector2 listener;
+
+    // Single-producer single-consumer trigger ring
+    Trigger triggers[TRIGGER_QUEUE_SIZE];
+    std::atomic<uint32_t> triggerHead;     // Written by Play()
+    std::atomic<uint32_t> triggerTail;     // Written by Update()
+
+    uint32_t stolenCount;
+    std::atomic<uint32_t> culledCount;
+    std::atomic<uint32_t> droppedCount;
+};
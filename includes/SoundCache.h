@@ -0,0 +1,64 @@
+#pragma once
+
+#include "../raylib/src/raylib.h"
+#include "CacheFile.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Pre-decoded sound pack: every sound stored in the audio device's mixing format
+//
+// raudio converts each sound to f32 at the device sample rate and channel count when it
+// is loaded, after decoding WAV/OGG/MP3/QOA. The pack keeps that converted PCM in one flat
+// file, memory-mapped on Open(), so a cached LoadSound() is a single copy into the audio
+// buffer with no decode or resample. Entries are keyed by path and invalidated by file
+// size and modification time. Sounds that miss are cooked with the same conversion and the
+// pack is rewritten on Close(); a pack made for another device format is ignored.
+class SoundCache {
+public:
+    static constexpr const char* CACHE_DIRECTORY = "cache";
+    static constexpr const char* CACHE_PATH = "cache/sounds.pcm";
+
+    SoundCache();
+    ~SoundCache();
+
+    // Needs an initialized audio device (the pack format depends on it)
+    bool Open();
+    void Close();
+    bool IsOpen() const { return isOpen; }
+
+    Sound LoadSound(const std::string& filePath);
+
+    int GetHitCount() const { return hitCount; }
+    int GetMissCount() const { return missCount; }
+
+private:
+    struct Entry {
+        CacheFile::SourceStamp source;
+        uint32_t frameCount;
+        uint32_t reserved;
+        uint64_t dataOffset;
+    };
+
+    // Sound loaded this session, written back to the pack on Close()
+    struct PackedSound {
+        Entry entry;
+        const float* mapped;        // Samples in the pack (hit), nullptr when cooked
+        std::vector<float> cooked;  // Samples converted this session (miss)
+    };
+
+    const Entry* FindEntry(uint64_t pathHash) const;
+    void WritePack();
+
+    MappedFile pack;
+    const Entry* entries;
+    uint32_t entryCount;
+    unsigned int sampleRate;
+    unsigned int channels;
+    bool isOpen;
+    bool isDirty;
+    int hitCount;
+    int missCount;
+    std::vector<PackedSound> sessionSounds;
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "../raylib/src/raylib.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <string>
+
+// Decoded image cache in front of raylib's LoadImage
+//
+// The first load of a texture decodes the source file (PNG, GIF, ...) as usual and writes the
+// decoded pixels to CACHE_DIRECTORY as one file per source: a small header and the raw pixel
+// data, in whatever format LoadImage produced. Later loads memory-map that file, so a cached
+// LoadTexture() uploads straight from the mapped pages with no decode and no copy. Files are
+// keyed by source path and invalidated by source size and modification time.
+class TextureCache {
+public:
+    static constexpr const char* CACHE_DIRECTORY = "cache/textures";
+
+    // Same results as raylib's LoadImage()/LoadTexture(), images are freed with UnloadImage()
+    static Image LoadImage(const std::string& filePath);
+    static Texture2D LoadTexture(const std::string& filePath);
+
+private:
+    static std::string GetCachePath(uint64_t pathHash);
+    // On a hit, image.data points into the mapped file and is valid while file stays open
+    static bool OpenCached(const std::string& filePath, MappedFile& file, Image& image);
+    static void SaveToCache(const std::string& filePath, const Image& image);
+    static Image DecodeImage(const std::string& filePath);
+};
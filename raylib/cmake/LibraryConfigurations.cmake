@@ -107,6 +107,17 @@ elseif ("${PLATFORM}" MATCHES "DRM")
     set(LIBS_PRIVATE ${GLESV2} ${EGL} ${DRM} ${GBM} atomic pthread dl)
     set(LIBS_PUBLIC m)
 
+elseif ("${PLATFORM}" MATCHES "Headless")
+    # No window or GPU, frames are rendered by rlsw into memory
+    set(PLATFORM_CPP "PLATFORM_HEADLESS")
+    set(GRAPHICS "GRAPHICS_API_OPENGL_11_SOFTWARE")
+
+    if (UNIX)
+        find_library(pthread NAMES pthread)
+        set(LIBS_PRIVATE pthread ${CMAKE_DL_LIBS})
+        set(LIBS_PUBLIC m)
+    endif ()
+
 elseif ("${PLATFORM}" MATCHES "SDL")
 	# First, check if SDL is included as a subdirectory
 	if(TARGET SDL3::SDL3)
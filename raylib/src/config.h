@@ -138,6 +138,13 @@
 #define RL_CULL_DISTANCE_NEAR              0.05       // Default projection matrix near cull distance
 #define RL_CULL_DISTANCE_FAR             4000.0       // Default projection matrix far cull distance
 
+// Software renderer (GRAPHICS_API_OPENGL_11_SOFTWARE): threads rasterizing each batch, 0: one per CPU core
+#if !defined(PLATFORM_WEB)
+    #define SW_RASTER_THREADS                  0
+#endif
+// Software renderer: rasterize and present only the screen regions that changed since the previous frame
+#define SW_DAMAGE_TRACKING                     1
+
 // Default shader vertex attribute locations
 #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION    0
 #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD    1
@@ -209,6 +216,11 @@
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
 
+// Threads splitting large image operations by rows (ImageDraw(), ImageResize(), ImageColorTint()...), 0: one per CPU core
+#if !defined(PLATFORM_WEB)
+    #define IMAGE_PROCESSING_THREADS    0
+#endif
+
 //------------------------------------------------------------------------------------
 // Module: rtext - Configuration Flags
 //------------------------------------------------------------------------------------
@@ -273,6 +285,8 @@
 //#define SUPPORT_FILEFORMAT_FLAC         1
 #define SUPPORT_FILEFORMAT_XM           1
 #define SUPPORT_FILEFORMAT_MOD          1
+// Decode music streams on a background thread per stream (UpdateMusicStream() is not required)
+#define SUPPORT_MUSIC_DECODE_THREAD     1
 
 // raudio: Configuration values
 //------------------------------------------------------------------------------------
@@ -281,6 +295,7 @@
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
 #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MUSIC_DECODE_BUFFER_MS          1000    // Decoded music kept ahead of playback (milliseconds), covers main thread hitches
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -51,6 +51,45 @@
 *           #define SW_MAX_MODELVIEW_STACK_SIZE     8
 *           #define SW_MAX_TEXTURE_STACK_SIZE       2
 *           #define SW_MAX_TEXTURES                 128
+*           #define SW_RASTER_THREADS               1
+*           #define SW_RASTER_MAX_THREADS           16
+*           #define SW_RASTER_TILE_HEIGHT           32
+*           #define SW_RASTER_PARALLEL_MIN_AREA     16384
+*           #define SW_SIMD                         1
+*           #define SW_INTEGER_2D                   1
+*           #define SW_DAMAGE_TRACKING              0
+*           #define SW_DAMAGE_CELL_SIZE             16
+*
+*       SW_RASTER_THREADS selects binned rasterization: primitives submitted between swBegin()
+*       and swEnd() are clipped, projected and sorted into screen tiles (bands of
+*       SW_RASTER_TILE_HEIGHT rows), then swEnd() rasterizes the tiles in parallel on a worker
+*       pool. Primitives keep their submission order within each tile, so blending and depth
+*       results are identical to the immediate path. 1 keeps immediate single-threaded
+*       rasterization, 0 uses one thread per CPU core. Batches covering less than
+*       SW_RASTER_PARALLEL_MIN_AREA pixels are rasterized on the calling thread
+*
+*       SW_SIMD shades triangle and quad pixels with SSE2 or NEON vectors, one RGBA color per
+*       vector from texture fetch to framebuffer write. 0 selects the scalar fallback, results
+*       are identical either way
+*
+*       SW_INTEGER_2D renders orthographic draws without depth test (raylib 2D mode) through an
+*       8-bit integer pipeline: nearest RGBA8 texel fetch with fixed point UV stepping, integer
+*       tint and alpha blending, direct RGB888 writes. It is selected per primitive when the
+*       vertex color is uniform, the texture is RGBA8 with nearest filtering and blending is
+*       off or SRC_ALPHA/ONE_MINUS_SRC_ALPHA. Colors may differ from the float path by one
+*       unit per channel, and samples exactly on a texel edge take the texel exact math gives
+*       (even pixel art scaling). Requires SW_COLOR_BUFFER_BITS 24
+*
+*       SW_DAMAGE_TRACKING defers rasterization to the end of the frame: clears and primitives
+*       are recorded with the state they need and rasterized by swFlush() or by anything
+*       reading the framebuffer. Each command is hashed into the screen cells (squares of
+*       SW_DAMAGE_CELL_SIZE pixels) it overlaps, cells hashing like the previous frame keep
+*       their pixels and only the changed ones are cleared and rasterized again, clipped to
+*       the damaged rectangles. swCopyFramebufferDamage() copies the regions changed since its
+*       last call, for presentation. Cells are only skipped in frames with a full color clear
+*       (and a depth clear before any depth tested draw), other frames are redrawn entirely.
+*       Texture data bound without copy must not change in place. Requires SW_RASTER_THREADS
+*       other than 1
 *
 * 
 *   LICENSE: MIT
@@ -139,6 +178,38 @@
     #define SW_MAX_TEXTURE_STACK_SIZE       2
 #endif
 
+#ifndef SW_RASTER_THREADS
+    #define SW_RASTER_THREADS               1       // Rasterization threads including the caller, 0: one per CPU core
+#endif
+
+#ifndef SW_RASTER_MAX_THREADS
+    #define SW_RASTER_MAX_THREADS           16
+#endif
+
+#ifndef SW_RASTER_TILE_HEIGHT
+    #define SW_RASTER_TILE_HEIGHT           32      // Tile height in rows, tiles span the framebuffer width
+#endif
+
+#ifndef SW_RASTER_PARALLEL_MIN_AREA
+    #define SW_RASTER_PARALLEL_MIN_AREA     16384   // Minimum batch area (pixels) worth waking the workers
+#endif
+
+#ifndef SW_SIMD
+    #define SW_SIMD                         1       // Vectorized pixel shading when the target has SSE2/NEON
+#endif
+
+#ifndef SW_INTEGER_2D
+    #define SW_INTEGER_2D                   1       // Integer RGBA8 pipeline for 2D draws (24-bit color buffer only)
+#endif
+
+#ifndef SW_DAMAGE_TRACKING
+    #define SW_DAMAGE_TRACKING              0       // Rasterize only the screen cells that changed since the last frame
+#endif
+
+#ifndef SW_DAMAGE_CELL_SIZE
+    #define SW_DAMAGE_CELL_SIZE             16      // Damage cell size in pixels (square)
+#endif
+
 #ifndef SW_MAX_TEXTURES
     #define SW_MAX_TEXTURES                 128
 #endif
@@ -322,6 +393,8 @@ typedef double              GLclampd;
 // OpenGL Bindings to rlsw
 //----------------------------------------------------------------------------------
 #define glReadPixels(x, y, w, h, f, t, p)           swCopyFramebuffer((x), (y), (w), (h), (f), (t), (p))
+#define glFlush()                                   swFlush()
+#define glFinish()                                  swFlush()
 #define glEnable(state)                             swEnable((state))
 #define glDisable(state)                            swDisable((state))
 #define glGetFloatv(pname, params)                  swGetFloatv((pname), (params))
@@ -526,8 +599,10 @@ SWAPI void swClose(void);
 
 SWAPI bool swResizeFramebuffer(int w, int h);
 SWAPI void swCopyFramebuffer(int x, int y, int w, int h, SWformat format, SWtype type, void *pixels);
+SWAPI int swCopyFramebufferDamage(SWformat format, SWtype type, int pitch, void *pixels, int *rects, int maxRects);
 SWAPI void swBlitFramebuffer(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySrc, int wSrc, int hSrc, SWformat format, SWtype type, void *pixels);
 SWAPI void *swGetColorBuffer(int *w, int *h);
+SWAPI void swFlush(void);
 
 SWAPI void swEnable(SWstate state);
 SWAPI void swDisable(SWstate state);
@@ -609,6 +684,50 @@ SWAPI void swBindTexture(uint32_t id);
 #include <stddef.h>
 #include <math.h>           // Required for: floorf(), fabsf()
 
+#if SW_SIMD
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics
+        #define SW_SIMD_SSE2
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>       // Required for: NEON intrinsics
+        #define SW_SIMD_NEON
+    #endif
+#endif
+
+#if SW_INTEGER_2D && (SW_COLOR_BUFFER_BITS == 24)
+    #define SW_INTEGER_2D_RGB8      // The integer pipeline writes the 8:8:8 color buffer directly
+#endif
+
+#if SW_DAMAGE_TRACKING && (SW_RASTER_THREADS != 1)
+    #define SW_DAMAGE_DEFERRED      // Frames are recorded and rasterized on flush, within the damaged cells
+#endif
+
+#if (SW_RASTER_THREADS != 1)
+    #if defined(_WIN32)
+        // Win32 threading, declared here to avoid including windows.h (its names clash with raylib)
+        // NOTE: SRW locks and condition variables are a single pointer, zero-initialized
+        struct _SECURITY_ATTRIBUTES;
+        struct _RTL_SRWLOCK;
+        struct _RTL_CONDITION_VARIABLE;
+        #if defined(_WIN64)
+            typedef unsigned long long sw_win32_size_t;
+        #else
+            typedef unsigned long sw_win32_size_t;
+        #endif
+        __declspec(dllimport) void *__stdcall CreateThread(struct _SECURITY_ATTRIBUTES *attributes, sw_win32_size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(struct _RTL_SRWLOCK *lock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(struct _RTL_SRWLOCK *lock);
+        __declspec(dllimport) int __stdcall SleepConditionVariableSRW(struct _RTL_CONDITION_VARIABLE *cond, struct _RTL_SRWLOCK *lock, unsigned long milliseconds, unsigned long flags);
+        __declspec(dllimport) void __stdcall WakeAllConditionVariable(struct _RTL_CONDITION_VARIABLE *cond);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+    #else
+        #include <pthread.h>        // Required for: pthread_create(), pthread_mutex_lock(), pthread_cond_wait()
+        #include <unistd.h>         // Required for: sysconf()
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -621,6 +740,15 @@ SWAPI void swBindTexture(uint32_t id);
 
 #define SW_STATE_CHECK(flags)   ((RLSW.stateFlags & (flags)) == (flags))
 
+// Per pixel functions the raster variants need inlined (so their state checks fold away)
+#if defined(_MSC_VER)
+    #define SW_FORCE_INLINE     __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+    #define SW_FORCE_INLINE     inline __attribute__((always_inline))
+#else
+    #define SW_FORCE_INLINE     inline
+#endif
+
 #define SW_STATE_SCISSOR_TEST   (1 << 0)
 #define SW_STATE_TEXTURE_2D     (1 << 1)
 #define SW_STATE_DEPTH_TEST     (1 << 2)
@@ -658,6 +786,80 @@ typedef void (*sw_factor_f)(
 typedef float sw_matrix_t[4*4];
 typedef uint16_t sw_half_t;
 
+// Primitive ready for rasterization (clipped and projected)
+typedef enum {
+    SW_PRIMITIVE_POLYGON = 0,       // Convex polygon, rasterized as a triangle fan
+    SW_PRIMITIVE_QUAD_AXIS_ALIGNED, // Screen aligned quad (4 vertices)
+    SW_PRIMITIVE_LINE,              // Line (2 vertices)
+    SW_PRIMITIVE_POINT              // Point (1 vertex)
+} sw_primitive_type_t;
+
+// Framebuffer region a rasterizer may write, [xMin, xMax) x [yMin, yMax)
+typedef struct {
+    int xMin;
+    int yMin;
+    int xMax;
+    int yMax;
+} sw_tile_t;
+
+#if (SW_RASTER_THREADS != 1)
+#if defined(_WIN32)
+    typedef void *sw_thread_t;
+    typedef void *sw_mutex_t;       // SRWLOCK
+    typedef void *sw_cond_t;        // CONDITION_VARIABLE
+    #define SW_THREAD_RESULT unsigned long __stdcall
+#else
+    typedef pthread_t sw_thread_t;
+    typedef pthread_mutex_t sw_mutex_t;
+    typedef pthread_cond_t sw_cond_t;
+    #define SW_THREAD_RESULT void *
+#endif
+
+typedef struct {
+    sw_primitive_type_t type;
+    int firstVertex;                // Index in the binned vertex list
+    int vertexCount;
+#if defined(SW_DAMAGE_DEFERRED)
+    sw_tile_t bounds;               // Conservative screen bounds, within the framebuffer
+#endif
+} sw_primitive_t;
+
+typedef struct {
+    sw_tile_t tile;                 // Region rasterized for this bin
+    int *primitives;                // Primitives overlapping the tile, in submission order
+    int count;
+    int capacity;
+} sw_tile_bin_t;
+#endif
+
+#if defined(SW_DAMAGE_DEFERRED)
+// State read by the rasterizers, recorded with every deferred batch
+typedef struct {
+    uint32_t stateFlags;
+    uint32_t texture;
+    SWfactor srcFactor;
+    SWfactor dstFactor;
+    sw_factor_f srcFactorFunc;
+    sw_factor_f dstFactorFunc;
+    int vpMin[2];
+    int vpMax[2];
+    int scMin[2];
+    int scMax[2];
+    float pointRadius;
+    float lineWidth;
+} sw_raster_state_t;
+
+// Clear or swBegin()/swEnd() block waiting for the frame flush
+typedef struct {
+    sw_raster_state_t state;
+    uint32_t clearMask;             // Buffers cleared, the batch has no primitives when not 0
+    float clearColor[4];
+    float clearDepth;
+    int firstPrimitive;
+    int primitiveCount;
+} sw_batch_t;
+#endif
+
 typedef struct {
     float position[4];          // Position coordinates
     float texcoord[2];          // Texture coordinates
@@ -690,6 +892,10 @@ typedef struct {
 
     bool copy;                  // Flag indicating whether memory has been allocated
 
+#if defined(SW_DAMAGE_DEFERRED)
+    uint32_t version;           // Changes with the texture data or parameters, hashed by the batches using it
+#endif
+
 } sw_texture_t;
 
 typedef struct {
@@ -766,6 +972,61 @@ typedef struct {
 
     uint32_t stateFlags;
 
+#if (SW_RASTER_THREADS != 1)
+    struct {
+        int threadCount;                        // Threads rasterizing a batch, including the caller
+        bool binning;                           // Primitives are binned instead of rasterized (inside swBegin/swEnd)
+
+        sw_vertex_t *vertices;                  // Vertices of the binned primitives
+        int vertexCount;
+        int vertexCapacity;
+
+        sw_primitive_t *primitives;             // Binned primitives, in submission order
+        int primitiveCount;
+        int primitiveCapacity;
+
+        sw_tile_bin_t *bins;                    // One bin per tile (SW_RASTER_TILE_HEIGHT rows)
+        int binCount;                           // Bins allocated
+        int tileCount;                          // Tiles covering the framebuffer
+        int64_t area;                           // Approximate pixel area of the batch
+
+        sw_thread_t threads[SW_RASTER_MAX_THREADS - 1];
+        int workerCount;
+        sw_mutex_t lock;
+        sw_cond_t workCond;                     // Signaled when a batch is ready (or on quit)
+        sw_cond_t doneCond;                     // Signaled when the last worker finished a batch
+        uint32_t generation;                    // Batch counter, workers wait for it to change
+        int nextTile;
+        int pendingWorkers;
+        bool quit;
+    } raster;
+#endif
+
+#if defined(SW_DAMAGE_DEFERRED)
+    struct {
+        sw_batch_t *batches;                    // Commands recorded since the last flush, primitives in 'raster'
+        int batchCount;
+        int batchCapacity;
+        bool recording;                         // Primitives go to the last batch (inside swBegin/swEnd)
+        uint64_t batchHash;                     // Hash of the recording batch state
+
+        int cellsX, cellsY;                     // Damage cells covering the framebuffer
+        int cellCapacity;
+        uint64_t *cellHashes;                   // Hash of the recorded commands overlapping each cell
+        uint64_t *prevCellHashes;               // Cell hashes of the last flushed frame
+        uint8_t *cellDamage;                    // Cells rasterized by the current flush
+        uint8_t *presentDamage;                 // Cells changed since the last swCopyFramebufferDamage()
+        sw_tile_t *rects;                       // Damaged cells merged into rectangles
+        int rectCount;
+        int *openRects;                         // Scratch for the merge, rectangles still growing down
+
+        bool prevValid;                         // Previous cell hashes describe the framebuffer content
+        uint32_t clearedMask;                   // Buffers the recorded frame clears entirely
+        bool depthDependent;                    // Recorded frame depth tests before clearing depth
+        uint32_t textureVersion;                // Last version given to a texture
+    } damage;
+#endif
+
 } sw_context_t;
 
 //----------------------------------------------------------------------------------
@@ -843,6 +1104,14 @@ static inline float sw_fract(float x)
     return (x - floorf(x));
 }
 
+// Texel coordinate wrapped into [0, size), same result as the modulo but without
+// the division for coordinates already in range (all of them but the edges)
+static inline int sw_wrap_repeat(int x, int size)
+{
+    if ((unsigned int)x < (unsigned int)size) return x;
+    return (x%size + size)%size;
+}
+
 static inline int sw_clampi(int v, int min, int max)
 {
     if (v < min) return min;
@@ -937,6 +1206,129 @@ static inline void sw_add_vertex_grad_PTCH(
     out->homogeneous[3] += gradients->homogeneous[3];
 }
 
+// Vector helper functions
+// NOTE: A sw_v4_t holds one RGBA color. Every operation matches the scalar per-channel
+// code it replaces, min/max return the second operand when a value is NaN (SSE semantics)
+#if defined(SW_SIMD_SSE2)
+
+typedef __m128 sw_v4_t;
+
+static inline sw_v4_t sw_v4_load(const float *p) { return _mm_loadu_ps(p); }
+static inline void sw_v4_store(float *p, sw_v4_t v) { _mm_storeu_ps(p, v); }
+static inline sw_v4_t sw_v4_set1(float x) { return _mm_set1_ps(x); }
+static inline sw_v4_t sw_v4_add(sw_v4_t a, sw_v4_t b) { return _mm_add_ps(a, b); }
+static inline sw_v4_t sw_v4_sub(sw_v4_t a, sw_v4_t b) { return _mm_sub_ps(a, b); }
+static inline sw_v4_t sw_v4_mul(sw_v4_t a, sw_v4_t b) { return _mm_mul_ps(a, b); }
+static inline sw_v4_t sw_v4_min(sw_v4_t a, sw_v4_t b) { return _mm_min_ps(a, b); }
+static inline sw_v4_t sw_v4_max(sw_v4_t a, sw_v4_t b) { return _mm_max_ps(a, b); }
+static inline sw_v4_t sw_v4_splat_alpha(sw_v4_t v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)); }
+
+// RGB from rgb, alpha from a
+static inline sw_v4_t sw_v4_merge_alpha(sw_v4_t rgb, sw_v4_t a)
+{
+    sw_v4_t t = _mm_shuffle_ps(a, rgb, _MM_SHUFFLE(2, 2, 3, 3));    // a3, a3, rgb2, rgb2
+    return _mm_shuffle_ps(rgb, t, _MM_SHUFFLE(0, 2, 1, 0));         // rgb0, rgb1, rgb2, a3
+}
+
+static inline sw_v4_t sw_v4_from_u8(uint32_t packed)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_cvtsi32_si128((int)packed);
+    v = _mm_unpacklo_epi16(_mm_unpacklo_epi8(v, zero), zero);
+    return _mm_cvtepi32_ps(v);
+}
+
+static inline uint32_t sw_v4_to_u8(sw_v4_t v)
+{
+    __m128i i = _mm_cvttps_epi32(v);
+    i = _mm_packs_epi32(i, i);
+    i = _mm_packus_epi16(i, i);
+    return (uint32_t)_mm_cvtsi128_si32(i);
+}
+
+#elif defined(SW_SIMD_NEON)
+
+typedef float32x4_t sw_v4_t;
+
+static inline sw_v4_t sw_v4_load(const float *p) { return vld1q_f32(p); }
+static inline void sw_v4_store(float *p, sw_v4_t v) { vst1q_f32(p, v); }
+static inline sw_v4_t sw_v4_set1(float x) { return vdupq_n_f32(x); }
+static inline sw_v4_t sw_v4_add(sw_v4_t a, sw_v4_t b) { return vaddq_f32(a, b); }
+static inline sw_v4_t sw_v4_sub(sw_v4_t a, sw_v4_t b) { return vsubq_f32(a, b); }
+static inline sw_v4_t sw_v4_mul(sw_v4_t a, sw_v4_t b) { return vmulq_f32(a, b); }
+static inline sw_v4_t sw_v4_min(sw_v4_t a, sw_v4_t b) { return vbslq_f32(vcltq_f32(a, b), a, b); }
+static inline sw_v4_t sw_v4_max(sw_v4_t a, sw_v4_t b) { return vbslq_f32(vcgtq_f32(a, b), a, b); }
+static inline sw_v4_t sw_v4_splat_alpha(sw_v4_t v) { return vdupq_n_f32(vgetq_lane_f32(v, 3)); }
+static inline sw_v4_t sw_v4_merge_alpha(sw_v4_t rgb, sw_v4_t a) { return vsetq_lane_f32(vgetq_lane_f32(a, 3), rgb, 3); }
+
+static inline sw_v4_t sw_v4_from_u8(uint32_t packed)
+{
+    uint16x8_t w = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(packed)));
+    return vcvtq_f32_u32(vmovl_u16(vget_low_u16(w)));
+}
+
+static inline uint32_t sw_v4_to_u8(sw_v4_t v)
+{
+    // Truncation like the scalar cast, out of range values saturate
+    uint16x4_t w = vqmovn_u32(vcvtq_u32_f32(v));
+    uint8x8_t b = vqmovn_u16(vcombine_u16(w, w));
+    return vget_lane_u32(vreinterpret_u32_u8(b), 0);
+}
+
+#else
+
+typedef struct { float v[4]; } sw_v4_t;
+
+static inline sw_v4_t sw_v4_load(const float *p) { sw_v4_t r = { { p[0], p[1], p[2], p[3] } }; return r; }
+static inline void sw_v4_store(float *p, sw_v4_t v) { p[0] = v.v[0]; p[1] = v.v[1]; p[2] = v.v[2]; p[3] = v.v[3]; }
+static inline sw_v4_t sw_v4_set1(float x) { sw_v4_t r = { { x, x, x, x } }; return r; }
+static inline sw_v4_t sw_v4_add(sw_v4_t a, sw_v4_t b) { sw_v4_t r = { { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } }; return r; }
+static inline sw_v4_t sw_v4_sub(sw_v4_t a, sw_v4_t b) { sw_v4_t r = { { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] } }; return r; }
+static inline sw_v4_t sw_v4_mul(sw_v4_t a, sw_v4_t b) { sw_v4_t r = { { a.v[0]*b.v[0], a.v[1]*b.v[1], a.v[2]*b.v[2], a.v[3]*b.v[3] } }; return r; }
+static inline float sw_v4_min1(float a, float b) { return (a < b)? a : b; }
+static inline float sw_v4_max1(float a, float b) { return (a > b)? a : b; }
+static inline sw_v4_t sw_v4_min(sw_v4_t a, sw_v4_t b) { sw_v4_t r = { { sw_v4_min1(a.v[0], b.v[0]), sw_v4_min1(a.v[1], b.v[1]), sw_v4_min1(a.v[2], b.v[2]), sw_v4_min1(a.v[3], b.v[3]) } }; return r; }
+static inline sw_v4_t sw_v4_max(sw_v4_t a, sw_v4_t b) { sw_v4_t r = { { sw_v4_max1(a.v[0], b.v[0]), sw_v4_max1(a.v[1], b.v[1]), sw_v4_max1(a.v[2], b.v[2]), sw_v4_max1(a.v[3], b.v[3]) } }; return r; }
+static inline sw_v4_t sw_v4_splat_alpha(sw_v4_t v) { return sw_v4_set1(v.v[3]); }
+static inline sw_v4_t sw_v4_merge_alpha(sw_v4_t rgb, sw_v4_t a) { rgb.v[3] = a.v[3]; return rgb; }
+
+static inline sw_v4_t sw_v4_from_u8(uint32_t packed)
+{
+    sw_v4_t r = { { (float)(packed & 0xFF), (float)((packed >> 8) & 0xFF), (float)((packed >> 16) & 0xFF), (float)(packed >> 24) } };
+    return r;
+}
+
+static inline uint32_t sw_v4_to_u8(sw_v4_t v)
+{
+    return (uint32_t)(uint8_t)v.v[0] | ((uint32_t)(uint8_t)v.v[1] << 8) | ((uint32_t)(uint8_t)v.v[2] << 16) | ((uint32_t)(uint8_t)v.v[3] << 24);
+}
+
+#endif
+
+static inline sw_v4_t sw_v4_saturate(sw_v4_t v)
+{
+    // Same as sw_saturate() for every non-NaN value
+    return sw_v4_min(sw_v4_max(v, sw_v4_set1(0.0f)), sw_v4_set1(1.0f));
+}
+
+// Normalized color from 4 bytes (R, G, B, A), as sw_get_pixel_rgba_8888()
+static inline sw_v4_t sw_v4_from_rgba8(const uint8_t *p)
+{
+    uint32_t packed = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    return sw_v4_mul(sw_v4_from_u8(packed), sw_v4_set1(1.0f/255));
+}
+
+// Normalized color from 3 bytes (R, G, B) with alpha 1.0f, as sw_get_pixel_rgb_888()
+static inline sw_v4_t sw_v4_from_rgb8(const uint8_t *p)
+{
+    static const float scale[4] = { 1.0f/255, 1.0f/255, 1.0f/255, 0.0f };
+    static const float alpha[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+    // Alpha lane becomes 0*0 + 1
+    uint32_t packed = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+    return sw_v4_add(sw_v4_mul(sw_v4_from_u8(packed), sw_v4_load(scale)), sw_v4_load(alpha));
+}
+
 // Half floating point management functions
 static inline uint32_t sw_f16_to_f32_ui(uint16_t h)
 {
@@ -1239,6 +1631,36 @@ static inline void sw_framebuffer_fill_color(void *ptr, int size, const float co
 
 #endif // SW_COLOR_BUFFER_BITS
 
+#if (SW_COLOR_BUFFER_BITS == 24)
+static inline sw_v4_t sw_framebuffer_read_color_v4(const void *src)
+{
+    return sw_v4_from_rgb8((const uint8_t *)src);
+}
+
+static inline void sw_framebuffer_write_color_v4(void *dst, sw_v4_t color)
+{
+    uint32_t packed = sw_v4_to_u8(sw_v4_mul(color, sw_v4_set1((float)UINT8_MAX)));
+
+    ((uint8_t *)dst)[0] = (uint8_t)packed;
+    ((uint8_t *)dst)[1] = (uint8_t)(packed >> 8);
+    ((uint8_t *)dst)[2] = (uint8_t)(packed >> 16);
+}
+#else
+static inline sw_v4_t sw_framebuffer_read_color_v4(const void *src)
+{
+    float color[4];
+    sw_framebuffer_read_color(color, src);
+    return sw_v4_load(color);
+}
+
+static inline void sw_framebuffer_write_color_v4(void *dst, sw_v4_t color)
+{
+    float values[4];
+    sw_v4_store(values, color);
+    sw_framebuffer_write_color(dst, values);
+}
+#endif
+
 #if (SW_DEPTH_BUFFER_BITS == 8)
 
 static inline float sw_framebuffer_read_depth(const void *src)
@@ -1484,22 +1906,24 @@ static inline void sw_framebuffer_fill(void *colorPtr, void *depthPtr, int size,
 }
 
 #define DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(name, DST_PTR_T)                      \
-static inline void sw_framebuffer_copy_to_##name(int x, int y, int w, int h, DST_PTR_T *dst)   \
+static inline void sw_framebuffer_copy_to_##name(int x, int y, int w, int h, int pitch, void *pixels)  \
 {                                                                               \
-    const void *src = RLSW.framebuffer.color;                                   \
+    for (int iy = y; iy < y + h; iy++) {                                        \
+        const void *src = sw_framebuffer_get_color_addr(RLSW.framebuffer.color, iy*RLSW.framebuffer.width + x);  \
+        DST_PTR_T *dst = (DST_PTR_T *)((uint8_t *)pixels + (size_t)(iy - y)*pitch);  \
                                                                                 \
-    for (int iy = y; iy < h; iy++) {                                            \
-        for (int ix = x; ix < w; ix++) {                                        \
+        for (int ix = 0; ix < w; ix++) {                                        \
             uint8_t color[4];                                                   \
             sw_framebuffer_read_color8(color, src);                             \
 
 #define DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(name, DST_PTR_T)                      \
-static inline void sw_framebuffer_copy_to_##name(int x, int y, int w, int h, DST_PTR_T *dst)   \
+static inline void sw_framebuffer_copy_to_##name(int x, int y, int w, int h, int pitch, void *pixels)  \
 {                                                                               \
-    const void *src = RLSW.framebuffer.color;                                   \
+    for (int iy = y; iy < y + h; iy++) {                                        \
+        const void *src = sw_framebuffer_get_color_addr(RLSW.framebuffer.color, iy*RLSW.framebuffer.width + x);  \
+        DST_PTR_T *dst = (DST_PTR_T *)((uint8_t *)pixels + (size_t)(iy - y)*pitch);  \
                                                                                 \
-    for (int iy = y; iy < h; iy++) {                                            \
-        for (int ix = x; ix < w; ix++) {                                        \
+        for (int ix = 0; ix < w; ix++) {                                        \
             float color[4];                                                     \
             sw_framebuffer_read_color(color, src);                              \
 
@@ -2156,17 +2580,44 @@ static inline void sw_get_pixel(float *color, const void *pixels, uint32_t offse
 
 // Texture sampling functionality
 
-static inline void sw_texture_sample_nearest(float *color, const sw_texture_t *tex, float u, float v)
+static inline SWfilter sw_texture_get_filter(const sw_texture_t *tex, float duDx, float duDy, float dvDx, float dvDy)
+{
+    // Previous method: There is no need to compute the square root
+    // because using the squared value, the comparison remains `L2 > 1.0f*1.0f`
+    //float du = sqrtf(duDx*duDx + duDy*duDy);
+    //float dv = sqrtf(dvDx*dvDx + dvDy*dvDy);
+    //float L = (du > dv)? du : dv;
+
+    // Calculate the derivatives for each axis
+    float du2 = duDx*duDx + duDy*duDy;
+    float dv2 = dvDx*dvDx + dvDy*dvDy;
+    float L2 = (du2 > dv2)? du2 : dv2;
+
+    return (L2 > 1.0f)? tex->minFilter : tex->magFilter;
+}
+
+static SW_FORCE_INLINE sw_v4_t sw_get_pixel_v4(const void *pixels, uint32_t offset, sw_pixelformat_t format)
+{
+    // 8-bit RGBA/RGB are the common cases (raylib images), converted without a round trip through memory
+    if (format == SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return sw_v4_from_rgba8((const uint8_t *)pixels + 4*offset);
+    if (format == SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8) return sw_v4_from_rgb8((const uint8_t *)pixels + 3*offset);
+
+    float color[4] = { 0 };
+    sw_get_pixel(color, pixels, offset, format);
+    return sw_v4_load(color);
+}
+
+static SW_FORCE_INLINE sw_v4_t sw_texture_sample_nearest(const sw_texture_t *tex, float u, float v)
 {
     u = (tex->sWrap == SW_REPEAT)? sw_fract(u) : sw_saturate(u);
     v = (tex->tWrap == SW_REPEAT)? sw_fract(v) : sw_saturate(v);
 
     int x = u*tex->width, y = v*tex->height;
 
-    sw_get_pixel(color, tex->pixels.cptr, y*tex->width + x, tex->format);
+    return sw_get_pixel_v4(tex->pixels.cptr, y*tex->width + x, tex->format);
 }
 
-static inline void sw_texture_sample_linear(float *color, const sw_texture_t *tex, float u, float v)
+static SW_FORCE_INLINE sw_v4_t sw_texture_sample_linear(const sw_texture_t *tex, float u, float v)
 {
     // TODO: REVIEW: With a bit more cleverness we could clearly reduce the
     // number of operations here, but for now it works fine.
@@ -2190,8 +2641,8 @@ static inline void sw_texture_sample_linear(float *color, const sw_texture_t *te
     }
     else
     {
-        x0 = (x0%tex->width + tex->width)%tex->width;
-        x1 = (x1%tex->width + tex->width)%tex->width;
+        x0 = sw_wrap_repeat(x0, tex->width);
+        x1 = sw_wrap_repeat(x1, tex->width);
     }
 
     if (tex->tWrap == SW_CLAMP)
@@ -2201,45 +2652,26 @@ static inline void sw_texture_sample_linear(float *color, const sw_texture_t *te
     }
     else
     {
-        y0 = (y0%tex->height + tex->height)%tex->height;
-        y1 = (y1%tex->height + tex->height)%tex->height;
+        y0 = sw_wrap_repeat(y0, tex->height);
+        y1 = sw_wrap_repeat(y1, tex->height);
     }
 
-    float c00[4], c10[4], c01[4], c11[4];
-    sw_get_pixel(c00, tex->pixels.cptr, y0*tex->width + x0, tex->format);
-    sw_get_pixel(c10, tex->pixels.cptr, y0*tex->width + x1, tex->format);
-    sw_get_pixel(c01, tex->pixels.cptr, y1*tex->width + x0, tex->format);
-    sw_get_pixel(c11, tex->pixels.cptr, y1*tex->width + x1, tex->format);
+    sw_v4_t c00 = sw_get_pixel_v4(tex->pixels.cptr, y0*tex->width + x0, tex->format);
+    sw_v4_t c10 = sw_get_pixel_v4(tex->pixels.cptr, y0*tex->width + x1, tex->format);
+    sw_v4_t c01 = sw_get_pixel_v4(tex->pixels.cptr, y1*tex->width + x0, tex->format);
+    sw_v4_t c11 = sw_get_pixel_v4(tex->pixels.cptr, y1*tex->width + x1, tex->format);
 
-    for (int i = 0; i < 4; i++)
-    {
-        float t = c00[i] + fx*(c10[i] - c00[i]);
-        float b = c01[i] + fx*(c11[i] - c01[i]);
-        color[i] = t + fy*(b - t);
-    }
+    sw_v4_t vfx = sw_v4_set1(fx);
+    sw_v4_t t = sw_v4_add(c00, sw_v4_mul(vfx, sw_v4_sub(c10, c00)));
+    sw_v4_t b = sw_v4_add(c01, sw_v4_mul(vfx, sw_v4_sub(c11, c01)));
+
+    return sw_v4_add(t, sw_v4_mul(sw_v4_set1(fy), sw_v4_sub(b, t)));
 }
 
-static inline void sw_texture_sample(float *color, const sw_texture_t *tex, float u, float v, float duDx, float duDy, float dvDx, float dvDy)
+static SW_FORCE_INLINE sw_v4_t sw_texture_sample(const sw_texture_t *tex, SWfilter filter, float u, float v)
 {
-    // Previous method: There is no need to compute the square root
-    // because using the squared value, the comparison remains `L2 > 1.0f*1.0f`
-    //float du = sqrtf(duDx*duDx + duDy*duDy);
-    //float dv = sqrtf(dvDx*dvDx + dvDy*dvDy);
-    //float L = (du > dv)? du : dv;
-
-    // Calculate the derivatives for each axis
-    float du2 = duDx*duDx + duDy*duDy;
-    float dv2 = dvDx*dvDx + dvDy*dvDy;
-    float L2 = (du2 > dv2)? du2 : dv2;
-
-    SWfilter filter = (L2 > 1.0f)? tex->minFilter : tex->magFilter;
-
-    switch (filter)
-    {
-        case SW_NEAREST: sw_texture_sample_nearest(color, tex, u, v); break;
-        case SW_LINEAR: sw_texture_sample_linear(color, tex, u, v); break;
-        default: break;
-    }
+    if (filter == SW_LINEAR) return sw_texture_sample_linear(tex, u, v);
+    return sw_texture_sample_nearest(tex, u, v);
 }
 
 // Color Blending functionality
@@ -2317,6 +2749,177 @@ static inline void sw_blend_colors(float *SW_RESTRICT dst/*[4]*/, const float *S
     dst[3] = srcFactor[3]*src[3] + dstFactor[3]*dst[3];
 }
 
+// Vector color blending, same factors as the sw_factor_*() functions above
+
+static SW_FORCE_INLINE sw_v4_t sw_blend_factor_v4(SWfactor factor, sw_v4_t src, sw_v4_t dst)
+{
+    const sw_v4_t one = sw_v4_set1(1.0f);
+
+    switch (factor)
+    {
+        case SW_ONE: return one;
+        case SW_SRC_COLOR: return src;
+        case SW_ONE_MINUS_SRC_COLOR: return sw_v4_sub(one, src);
+        case SW_SRC_ALPHA: return sw_v4_splat_alpha(src);
+        case SW_ONE_MINUS_SRC_ALPHA: return sw_v4_sub(one, sw_v4_splat_alpha(src));
+        case SW_DST_ALPHA: return sw_v4_splat_alpha(dst);
+        case SW_ONE_MINUS_DST_ALPHA: return sw_v4_sub(one, sw_v4_splat_alpha(dst));
+        case SW_DST_COLOR: return dst;
+        case SW_ONE_MINUS_DST_COLOR: return sw_v4_sub(one, dst);
+        case SW_SRC_ALPHA_SATURATE: return sw_v4_merge_alpha(one, sw_v4_min(src, one));
+        default: break;
+    }
+
+    return sw_v4_set1(0.0f);    // SW_ZERO
+}
+
+static SW_FORCE_INLINE sw_v4_t sw_blend_colors_v4(sw_v4_t dst, sw_v4_t src)
+{
+    sw_v4_t srcFactor = sw_blend_factor_v4(RLSW.srcFactor, src, dst);
+    sw_v4_t dstFactor = sw_blend_factor_v4(RLSW.dstFactor, src, dst);
+
+    return sw_v4_add(sw_v4_mul(srcFactor, src), sw_v4_mul(dstFactor, dst));
+}
+
+// Pixel shading shared by the triangle and quad scanlines: tint by the texture, blend, write
+static SW_FORCE_INLINE void sw_shade_pixel(void *cptr, sw_v4_t color, const sw_texture_t *tex, SWfilter filter,
+                                  float u, float v, bool texture, bool blend)
+{
+    if (texture) color = sw_v4_mul(color, sw_texture_sample(tex, filter, u, v));
+
+    if (blend)
+    {
+        sw_v4_t dst = sw_framebuffer_read_color_v4(cptr);
+        color = sw_v4_saturate(sw_blend_colors_v4(dst, color));
+    }
+
+    sw_framebuffer_write_color_v4(cptr, color);
+}
+
+#if defined(SW_INTEGER_2D_RGB8)
+// Integer RGBA8 pipeline, used for orthographic draws without depth test (raylib 2D mode)
+
+// Floor of x/255 for x up to 255*255, the truncation the float path does on write
+static inline uint32_t sw_div255(uint32_t x)
+{
+    return (x + 1 + (x >> 8)) >> 8;
+}
+
+// Texel coordinates are stepped in 32.32 fixed point. The start is nudged by 2^-16 texel so a
+// sample exactly on a texel edge (frequent when scaling sprites) picks the texel exact math
+// gives, the step rounding error stays far below that over any span
+static inline int64_t sw_texel_start_fixed(float uv, int size)
+{
+    return (int64_t)floor((double)uv*size*4294967296.0 + 0.5) + 65536;
+}
+
+static inline int64_t sw_texel_step_fixed(float uvDelta, double length, int size)
+{
+    return (int64_t)floor((double)uvDelta*size/length*4294967296.0 + 0.5);
+}
+
+// Whether the current state can use the integer pipeline (the vertices are checked separately)
+static inline bool sw_integer_2d_state_check(void)
+{
+    if (RLSW.stateFlags & SW_STATE_DEPTH_TEST) return false;
+
+    if ((RLSW.stateFlags & SW_STATE_BLEND) &&
+        ((RLSW.srcFactor != SW_SRC_ALPHA) || (RLSW.dstFactor != SW_ONE_MINUS_SRC_ALPHA))) return false;
+
+    if (RLSW.stateFlags & SW_STATE_TEXTURE_2D)
+    {
+        const sw_texture_t *tex = &RLSW.loadedTextures[RLSW.currentTexture];
+
+        if (tex->format != SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return false;
+        if ((tex->minFilter != SW_NEAREST) || (tex->magFilter != SW_NEAREST)) return false;
+    }
+
+    return true;
+}
+
+// Vertices must be orthographic (w = 1) and share one color within [0, 1], raylib tints a whole sprite
+static inline bool sw_integer_2d_vertex_check(const sw_vertex_t *vertices, int vertexCount)
+{
+    const float *color = vertices[0].color;
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (!((color[i] >= 0.0f) && (color[i] <= 1.0f))) return false;
+    }
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        const float *other = vertices[i].color;
+
+        if (vertices[i].homogeneous[3] != 1.0f) return false;
+        if ((other[0] != color[0]) || (other[1] != color[1]) || (other[2] != color[2]) || (other[3] != color[3])) return false;
+    }
+
+    return true;
+}
+
+// Returns false for opaque white, texels are then used as is (tiles and most sprites)
+static inline bool sw_integer_2d_tint(uint8_t tint[4], const float color[4])
+{
+    tint[0] = (uint8_t)(color[0]*255.0f + 0.5f);
+    tint[1] = (uint8_t)(color[1]*255.0f + 0.5f);
+    tint[2] = (uint8_t)(color[2]*255.0f + 0.5f);
+    tint[3] = (uint8_t)(color[3]*255.0f + 0.5f);
+
+    return ((tint[0] & tint[1] & tint[2] & tint[3]) != 255);
+}
+
+// Texel index along one axis of a 32.32 fixed point coordinate
+static SW_FORCE_INLINE int sw_texel_wrap(int64_t coord, int size, bool repeat)
+{
+    int x = (int)(coord >> 32);
+    return repeat? sw_wrap_repeat(x, size) : sw_clampi(x, 0, size - 1);
+}
+
+// Integer counterpart of sw_shade_pixel(), blending is always SRC_ALPHA/ONE_MINUS_SRC_ALPHA
+static SW_FORCE_INLINE void sw_shade_pixel_rgba8(uint8_t *cptr, const uint8_t tint[4], bool tinted,
+                                                 const uint8_t *texel, bool texture, bool blend)
+{
+    uint32_t r = tint[0], g = tint[1], b = tint[2], a = tint[3];
+
+    if (texture)
+    {
+        if (tinted)
+        {
+            r = sw_div255(r*texel[0]);
+            g = sw_div255(g*texel[1]);
+            b = sw_div255(b*texel[2]);
+            a = sw_div255(a*texel[3]);
+        }
+        else
+        {
+            r = texel[0];
+            g = texel[1];
+            b = texel[2];
+            a = texel[3];
+        }
+    }
+
+    if (blend)
+    {
+        // Transparent texels are skipped and opaque ones written as is
+        if (a == 0) return;
+
+        if (a < 255)
+        {
+            uint32_t invA = 255 - a;
+            r = sw_div255(r*a + cptr[0]*invA);
+            g = sw_div255(g*a + cptr[1]*invA);
+            b = sw_div255(b*a + cptr[2]*invA);
+        }
+    }
+
+    cptr[0] = (uint8_t)r;
+    cptr[1] = (uint8_t)g;
+    cptr[2] = (uint8_t)b;
+}
+#endif // SW_INTEGER_2D_RGB8
+
 // Projection helper functions
 
 static inline void sw_project_ndc_to_screen(float screen[2], const float ndc[4])
@@ -2532,13 +3135,16 @@ static inline void sw_triangle_clip_and_project(void)
 
 #define DEFINE_TRIANGLE_RASTER_SCANLINE(FUNC_NAME, ENABLE_TEXTURE, ENABLE_DEPTH_TEST, ENABLE_COLOR_BLEND) \
 static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,     \
-                             const sw_vertex_t *end, float duDy, float dvDy)        \
+                             const sw_vertex_t *end, float duDy, float dvDy,        \
+                             const sw_tile_t *tile)                                 \
 {                                                                                   \
     /* Convert and center the screen coordinates */                                 \
     int xStart = (int)(start->screen[0] + 0.5f);                                    \
     int xEnd   = (int)(end->screen[0] + 0.5f);                                      \
     int y      = (int)start->screen[1];                                             \
                                                                                     \
+    if ((xStart >= tile->xMax) || (xEnd <= tile->xMin)) return;                     \
+                                                                                    \
     /* Compute the inverse horizontal distance along the X axis */                  \
     float dx = end->screen[0] - start->screen[0];                                   \
     if (fabsf(dx) < 1e-6f) return;                                                  \
@@ -2576,13 +3182,25 @@ static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,
         v = start->texcoord[1];                                                     \
     }                                                                               \
                                                                                     \
+    /* Color is interpolated as one vector, exactly like per channel */             \
+    sw_v4_t colorV = sw_v4_load(color);                                             \
+    sw_v4_t dcDxV = sw_v4_load(dcDx);                                               \
+                                                                                    \
+    SWfilter filter = SW_NEAREST;                                                   \
+    if (ENABLE_TEXTURE) filter = sw_texture_get_filter(tex, duDx, duDy, dvDx, dvDy); \
+                                                                                    \
     /* Pre-calculate the starting pointers for the framebuffer row */               \
     void *cptr = sw_framebuffer_get_color_addr(RLSW.framebuffer.color, y*RLSW.framebuffer.width + xStart);  \
     void *dptr = sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, y*RLSW.framebuffer.width + xStart);  \
                                                                                     \
+    /* Columns left of the tile only step the interpolation */                      \
+    if (xEnd > tile->xMax) xEnd = tile->xMax;                                       \
+                                                                                    \
     /* Scanline rasterization */                                                    \
     for (int x = xStart; x < xEnd; x++)                                             \
     {                                                                               \
+        if (x < tile->xMin) goto discard;                                           \
+                                                                                    \
         /* Test and write depth */                                                  \
         if (ENABLE_DEPTH_TEST)                                                      \
         {                                                                           \
@@ -2595,50 +3213,16 @@ static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,
                                                                                     \
         /* Pixel color computation */                                               \
         float wRcp = 1.0f/w;                                                        \
-        float srcColor[4] = {                                                       \
-            color[0]*wRcp,                                                          \
-            color[1]*wRcp,                                                          \
-            color[2]*wRcp,                                                          \
-            color[3]*wRcp                                                           \
-        };                                                                          \
+        sw_v4_t srcColor = sw_v4_mul(colorV, sw_v4_set1(wRcp));                     \
                                                                                     \
-        if (ENABLE_TEXTURE)                                                         \
-        {                                                                           \
-            float texColor[4];                                                      \
-            float s = u*wRcp;                                                       \
-            float t = v*wRcp;                                                       \
-            sw_texture_sample(texColor, tex, s, t, duDx, duDy, dvDx, dvDy);         \
-            srcColor[0] *= texColor[0];                                             \
-            srcColor[1] *= texColor[1];                                             \
-            srcColor[2] *= texColor[2];                                             \
-            srcColor[3] *= texColor[3];                                             \
-        }                                                                           \
-                                                                                    \
-        if (ENABLE_COLOR_BLEND)                                                     \
-        {                                                                           \
-            float dstColor[4];                                                      \
-            sw_framebuffer_read_color(dstColor, cptr);                              \
-                                                                                    \
-            sw_blend_colors(dstColor, srcColor);                                    \
-            dstColor[0] = sw_saturate(dstColor[0]);                                 \
-            dstColor[1] = sw_saturate(dstColor[1]);                                 \
-            dstColor[2] = sw_saturate(dstColor[2]);                                 \
-                                                                                    \
-            sw_framebuffer_write_color(cptr, dstColor);                             \
-        }                                                                           \
-        else                                                                        \
-        {                                                                           \
-            sw_framebuffer_write_color(cptr, srcColor);                             \
-        }                                                                           \
+        sw_shade_pixel(cptr, srcColor, tex, filter, u*wRcp, v*wRcp,                 \
+                       ENABLE_TEXTURE, ENABLE_COLOR_BLEND);                         \
                                                                                     \
         /* Increment the interpolation parameter, UVs, and pointers */              \
     discard:                                                                        \
         z += dzDx;                                                                  \
         w += dwDx;                                                                  \
-        color[0] += dcDx[0];                                                        \
-        color[1] += dcDx[1];                                                        \
-        color[2] += dcDx[2];                                                        \
-        color[3] += dcDx[3];                                                        \
+        colorV = sw_v4_add(colorV, dcDxV);                                          \
         if (ENABLE_TEXTURE)                                                         \
         {                                                                           \
             u += duDx;                                                              \
@@ -2650,13 +3234,102 @@ static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,
     }                                                                               \
 }
 
-#define DEFINE_TRIANGLE_RASTER(FUNC_NAME, FUNC_SCANLINE, ENABLE_TEXTURE)            \
-static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1,          \
-                             const sw_vertex_t *v2, const sw_texture_t *tex)        \
+#if defined(SW_INTEGER_2D_RGB8)
+// Integer scanline for orthographic triangles (w = 1) with a uniform color, see sw_shade_pixel_rgba8()
+#define DEFINE_TRIANGLE_RASTER_SCANLINE_RGBA8(FUNC_NAME, ENABLE_TEXTURE, ENABLE_COLOR_BLEND) \
+static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,     \
+                             const sw_vertex_t *end, float duDy, float dvDy,        \
+                             const sw_tile_t *tile)                                 \
 {                                                                                   \
-    /* Swap vertices by increasing y */                                             \
-    if (v0->screen[1] > v1->screen[1]) { const sw_vertex_t *tmp = v0; v0 = v1; v1 = tmp; } \
-    if (v1->screen[1] > v2->screen[1]) { const sw_vertex_t *tmp = v1; v1 = v2; v2 = tmp; } \
+    /* Convert and center the screen coordinates */                                 \
+    int xStart = (int)(start->screen[0] + 0.5f);                                    \
+    int xEnd   = (int)(end->screen[0] + 0.5f);                                      \
+    int y      = (int)start->screen[1];                                             \
+                                                                                    \
+    if ((xStart >= tile->xMax) || (xEnd <= tile->xMin)) return;                     \
+                                                                                    \
+    float dx = end->screen[0] - start->screen[0];                                   \
+    if (fabsf(dx) < 1e-6f) return;                                                  \
+    float dxRcp = 1.0f/dx;                                                          \
+                                                                                    \
+    float z = start->homogeneous[2];                                                \
+    float dzDx = (end->homogeneous[2] - start->homogeneous[2])*dxRcp;               \
+                                                                                    \
+    /* The color is the same along the whole triangle */                            \
+    uint8_t tint[4];                                                                \
+    bool tinted = sw_integer_2d_tint(tint, start->color);                           \
+                                                                                    \
+    /* Texel coordinates stepped in 32.32 fixed point. The texture parameters */    \
+    /* are copied to locals, the byte stores below would force reloads */           \
+    const uint8_t *texPixels = NULL;                                                \
+    int texWidth = 0, texHeight = 0;                                                \
+    bool sRepeat = false, tRepeat = false;                                          \
+    int64_t s = 0, t = 0, sDx = 0, tDx = 0;                                         \
+    if (ENABLE_TEXTURE)                                                             \
+    {                                                                               \
+        texPixels = (const uint8_t *)tex->pixels.cptr;                              \
+        texWidth = tex->width;                                                      \
+        texHeight = tex->height;                                                    \
+        sRepeat = (tex->sWrap == SW_REPEAT);                                        \
+        tRepeat = (tex->tWrap == SW_REPEAT);                                        \
+        s = sw_texel_start_fixed(start->texcoord[0], texWidth);                     \
+        t = sw_texel_start_fixed(start->texcoord[1], texHeight);                    \
+        sDx = sw_texel_step_fixed(end->texcoord[0] - start->texcoord[0], dx, texWidth);  \
+        tDx = sw_texel_step_fixed(end->texcoord[1] - start->texcoord[1], dx, texHeight); \
+    }                                                                               \
+                                                                                    \
+    /* Columns left of the tile only step the interpolation (depth as floats, */    \
+    /* so it matches the untiled rasterization exactly) */                          \
+    int xFirst = (xStart > tile->xMin)? xStart : tile->xMin;                        \
+    if (xEnd > tile->xMax) xEnd = tile->xMax;                                       \
+    for (int x = xStart; x < xFirst; x++) z += dzDx;                                \
+    if (ENABLE_TEXTURE)                                                             \
+    {                                                                               \
+        s += (int64_t)(xFirst - xStart)*sDx;                                        \
+        t += (int64_t)(xFirst - xStart)*tDx;                                        \
+    }                                                                               \
+                                                                                    \
+    uint8_t *cptr = (uint8_t *)sw_framebuffer_get_color_addr(RLSW.framebuffer.color, y*RLSW.framebuffer.width + xFirst); \
+    void *dptr = sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, y*RLSW.framebuffer.width + xFirst); \
+                                                                                    \
+    int texRow = 0;                                                                 \
+    if (ENABLE_TEXTURE) texRow = sw_texel_wrap(t, texHeight, tRepeat)*texWidth;     \
+                                                                                    \
+    for (int x = xFirst; x < xEnd; x++)                                             \
+    {                                                                               \
+        sw_framebuffer_write_depth(dptr, z);                                        \
+                                                                                    \
+        const uint8_t *texel = NULL;                                                \
+        if (ENABLE_TEXTURE)                                                         \
+        {                                                                           \
+            if (tDx != 0) texRow = sw_texel_wrap(t, texHeight, tRepeat)*texWidth;   \
+            texel = texPixels + 4*(texRow + sw_texel_wrap(s, texWidth, sRepeat));   \
+        }                                                                           \
+                                                                                    \
+        sw_shade_pixel_rgba8(cptr, tint, tinted, texel,                             \
+                             ENABLE_TEXTURE, ENABLE_COLOR_BLEND);                   \
+                                                                                    \
+        z += dzDx;                                                                  \
+        if (ENABLE_TEXTURE)                                                         \
+        {                                                                           \
+            s += sDx;                                                               \
+            t += tDx;                                                               \
+        }                                                                           \
+                                                                                    \
+        cptr += 3;                                                                  \
+        sw_framebuffer_inc_depth_addr(&dptr);                                       \
+    }                                                                               \
+}
+#endif // SW_INTEGER_2D_RGB8
+
+#define DEFINE_TRIANGLE_RASTER(FUNC_NAME, FUNC_SCANLINE, ENABLE_TEXTURE)            \
+static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1,          \
+                             const sw_vertex_t *v2, const sw_texture_t *tex,        \
+                             const sw_tile_t *tile)                                 \
+{                                                                                   \
+    /* Swap vertices by increasing y */                                             \
+    if (v0->screen[1] > v1->screen[1]) { const sw_vertex_t *tmp = v0; v0 = v1; v1 = tmp; } \
+    if (v1->screen[1] > v2->screen[1]) { const sw_vertex_t *tmp = v1; v1 = v2; v2 = tmp; } \
     if (v0->screen[1] > v1->screen[1]) { const sw_vertex_t *tmp = v0; v0 = v1; v1 = tmp; } \
                                                                                     \
     /* Extracting coordinates from the sorted vertices */                           \
@@ -2686,6 +3359,8 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1,
     int yMiddle = (int)(y1 + 0.5f);                                                 \
     int yBottom = (int)(y2 + 0.5f);                                                 \
                                                                                     \
+    if ((yTop >= tile->yMax) || (yBottom <= tile->yMin)) return;                    \
+                                                                                    \
     /* Compute gradients for each side of the triangle */                           \
     sw_vertex_t vDy02, vDy01, vDy12;                                                \
     sw_get_vertex_grad_PTCH(&vDy02, v0, v2, invH02);                                \
@@ -2698,13 +3373,21 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1,
     sw_vertex_t vRight = *v0;                                                       \
     vRight.screen[0] = x0;                                                          \
                                                                                     \
+    /* Rows above the tile only step the edges, so interpolated values match */    \
+    /* the untiled rasterization exactly */                                         \
+    int yUpperEnd = (yMiddle < tile->yMax)? yMiddle : tile->yMax;                   \
+    int yLowerEnd = (yBottom < tile->yMax)? yBottom : tile->yMax;                   \
+                                                                                    \
     /* Scanline for the upper part of the triangle */                               \
-    for (int y = yTop; y < yMiddle; y++)                                            \
+    for (int y = yTop; y < yUpperEnd; y++)                                          \
     {                                                                               \
-        vLeft.screen[1] = vRight.screen[1] = y;                                     \
+        if (y >= tile->yMin)                                                        \
+        {                                                                           \
+            vLeft.screen[1] = vRight.screen[1] = y;                                 \
                                                                                     \
-        if (vLeft.screen[0] < vRight.screen[0]) FUNC_SCANLINE(tex, &vLeft, &vRight, vDy02.texcoord[0], vDy02.texcoord[1]); \
-        else FUNC_SCANLINE(tex, &vRight, &vLeft, vDy02.texcoord[0], vDy02.texcoord[1]); \
+            if (vLeft.screen[0] < vRight.screen[0]) FUNC_SCANLINE(tex, &vLeft, &vRight, vDy02.texcoord[0], vDy02.texcoord[1], tile); \
+            else FUNC_SCANLINE(tex, &vRight, &vLeft, vDy02.texcoord[0], vDy02.texcoord[1], tile); \
+        }                                                                           \
                                                                                     \
         sw_add_vertex_grad_PTCH(&vLeft, &vDy02);                                    \
         vLeft.screen[0]  += dx02;                                                   \
@@ -2712,15 +3395,20 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1,
         vRight.screen[0] += dx01;                                                   \
     }                                                                               \
                                                                                     \
+    if (yMiddle >= tile->yMax) return;                                              \
+                                                                                    \
     /* Scanline for the lower part of the triangle */                               \
     vRight = *v1, vRight.screen[0] = x1;                                            \
                                                                                     \
-    for (int y = yMiddle; y < yBottom; y++)                                         \
+    for (int y = yMiddle; y < yLowerEnd; y++)                                       \
     {                                                                               \
-        vLeft.screen[1] = vRight.screen[1] = y;                                     \
+        if (y >= tile->yMin)                                                        \
+        {                                                                           \
+            vLeft.screen[1] = vRight.screen[1] = y;                                 \
                                                                                     \
-        if (vLeft.screen[0] < vRight.screen[0]) FUNC_SCANLINE(tex, &vLeft, &vRight, vDy02.texcoord[0], vDy02.texcoord[1]); \
-        else FUNC_SCANLINE(tex, &vRight, &vLeft, vDy02.texcoord[0], vDy02.texcoord[1]); \
+            if (vLeft.screen[0] < vRight.screen[0]) FUNC_SCANLINE(tex, &vLeft, &vRight, vDy02.texcoord[0], vDy02.texcoord[1], tile); \
+            else FUNC_SCANLINE(tex, &vRight, &vLeft, vDy02.texcoord[0], vDy02.texcoord[1], tile); \
+        }                                                                           \
                                                                                     \
         sw_add_vertex_grad_PTCH(&vLeft, &vDy02);                                    \
         vLeft.screen[0]  += dx02;                                                   \
@@ -2747,30 +3435,45 @@ DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX_BLEND, sw_triangle_raster_scanline
 DEFINE_TRIANGLE_RASTER(sw_triangle_raster_DEPTH_BLEND, sw_triangle_raster_scanline_DEPTH_BLEND, false)
 DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH_BLEND, sw_triangle_raster_scanline_TEX_DEPTH_BLEND, true)
 
-static inline void sw_triangle_render(void)
-{
-    if (RLSW.stateFlags & SW_STATE_CULL_FACE)
-    {
-        if (!sw_triangle_face_culling()) return;
-    }
+#if defined(SW_INTEGER_2D_RGB8)
+DEFINE_TRIANGLE_RASTER_SCANLINE_RGBA8(sw_triangle_raster_scanline_RGBA8, 0, 0)
+DEFINE_TRIANGLE_RASTER_SCANLINE_RGBA8(sw_triangle_raster_scanline_RGBA8_TEX, 1, 0)
+DEFINE_TRIANGLE_RASTER_SCANLINE_RGBA8(sw_triangle_raster_scanline_RGBA8_BLEND, 0, 1)
+DEFINE_TRIANGLE_RASTER_SCANLINE_RGBA8(sw_triangle_raster_scanline_RGBA8_TEX_BLEND, 1, 1)
 
-    sw_triangle_clip_and_project();
+DEFINE_TRIANGLE_RASTER(sw_triangle_raster_RGBA8, sw_triangle_raster_scanline_RGBA8, false)
+DEFINE_TRIANGLE_RASTER(sw_triangle_raster_RGBA8_TEX, sw_triangle_raster_scanline_RGBA8_TEX, true)
+DEFINE_TRIANGLE_RASTER(sw_triangle_raster_RGBA8_BLEND, sw_triangle_raster_scanline_RGBA8_BLEND, false)
+DEFINE_TRIANGLE_RASTER(sw_triangle_raster_RGBA8_TEX_BLEND, sw_triangle_raster_scanline_RGBA8_TEX_BLEND, true)
+#endif
 
-    if (RLSW.vertexCounter < 3) return;
+static inline void sw_polygon_rasterize(const sw_vertex_t *polygon, int vertexCount, const sw_tile_t *tile)
+{
+    const sw_texture_t *tex = &RLSW.loadedTextures[RLSW.currentTexture];
 
     #define TRIANGLE_RASTER(RASTER_FUNC)                        \
     {                                                           \
-        for (int i = 0; i < RLSW.vertexCounter - 2; i++)        \
+        for (int i = 0; i < vertexCount - 2; i++)               \
         {                                                       \
             RASTER_FUNC(                                        \
-                &RLSW.vertexBuffer[0],                          \
-                &RLSW.vertexBuffer[i + 1],                      \
-                &RLSW.vertexBuffer[i + 2],                      \
-                &RLSW.loadedTextures[RLSW.currentTexture]       \
+                &polygon[0],                                    \
+                &polygon[i + 1],                                \
+                &polygon[i + 2],                                \
+                tex, tile                                       \
             );                                                  \
         }                                                       \
     }
 
+#if defined(SW_INTEGER_2D_RGB8)
+    if (sw_integer_2d_state_check() && sw_integer_2d_vertex_check(polygon, vertexCount))
+    {
+        if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_RGBA8_TEX_BLEND)
+        else if (SW_STATE_CHECK(SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_RGBA8_BLEND)
+        else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D)) TRIANGLE_RASTER(sw_triangle_raster_RGBA8_TEX)
+        else TRIANGLE_RASTER(sw_triangle_raster_RGBA8)
+    }
+    else
+#endif
     if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH_BLEND)
     else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_DEPTH_BLEND)
     else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_TEX_BLEND)
@@ -2783,6 +3486,22 @@ static inline void sw_triangle_render(void)
     #undef TRIANGLE_RASTER
 }
 
+static inline void sw_primitive_submit(sw_primitive_type_t type, const sw_vertex_t *vertices, int vertexCount);
+
+static inline void sw_triangle_render(void)
+{
+    if (RLSW.stateFlags & SW_STATE_CULL_FACE)
+    {
+        if (!sw_triangle_face_culling()) return;
+    }
+
+    sw_triangle_clip_and_project();
+
+    if (RLSW.vertexCounter < 3) return;
+
+    sw_primitive_submit(SW_PRIMITIVE_POLYGON, RLSW.vertexBuffer, RLSW.vertexCounter);
+}
+
 // Quad rendering logic
 
 static inline bool sw_quad_face_culling(void)
@@ -2900,7 +3619,7 @@ static inline bool sw_quad_is_axis_aligned(void)
     return ((horizontal == 2) && (vertical == 2));
 }
 
-static inline void sw_quad_sort_cw(const sw_vertex_t* *output)
+static inline void sw_quad_sort_cw(const sw_vertex_t *input, const sw_vertex_t* *output)
 {
     // Sort 4 quad vertices into clockwise order with fixed layout:
     //
@@ -2913,7 +3632,6 @@ static inline void sw_quad_sort_cw(const sw_vertex_t* *output)
     // - v1: top-right (minimum Y row, maximum X)
     // - v2: bottom-right (maximum Y, maximum X)
     // - v3: bottom-left (maximum Y, minimum X)
-    const sw_vertex_t *input = RLSW.vertexBuffer;
 
     // Separate vertices into top and bottom based on Y-coordinate
     const sw_vertex_t *top[2] = {NULL, NULL};
@@ -2978,10 +3696,10 @@ static inline void sw_quad_sort_cw(const sw_vertex_t* *output)
 // still appear perfectly aligned from a certain point of view?
 // Because in that case, we would still need to perform perspective division for textures and colors...
 #define DEFINE_QUAD_RASTER_AXIS_ALIGNED(FUNC_NAME, ENABLE_TEXTURE, ENABLE_DEPTH_TEST, ENABLE_COLOR_BLEND) \
-static inline void FUNC_NAME(void)                                              \
+static inline void FUNC_NAME(const sw_vertex_t *vertices, const sw_tile_t *tile) \
 {                                                                               \
     const sw_vertex_t *sortedVerts[4];                                          \
-    sw_quad_sort_cw(sortedVerts);                                               \
+    sw_quad_sort_cw(vertices, sortedVerts);                                     \
                                                                                 \
     const sw_vertex_t *v0 = sortedVerts[0];                                     \
     const sw_vertex_t *v1 = sortedVerts[1];                                     \
@@ -2998,6 +3716,8 @@ static inline void FUNC_NAME(void)
     int height = yMax - yMin;                                                   \
                                                                                 \
     if (width == 0 || height == 0) return;                                      \
+    if ((yMin >= tile->yMax) || (yMax <= tile->yMin)) return;                   \
+    if ((xMin >= tile->xMax) || (xMax <= tile->xMin)) return;                   \
                                                                                 \
     float wRcp = (width > 0.0f)? 1.0f/width : 0.0f;                             \
     float hRcp = (height > 0.0f)? 1.0f/height : 0.0f;                           \
@@ -3026,7 +3746,7 @@ static inline void FUNC_NAME(void)
     zDy = (v3->homogeneous[2] - v0->homogeneous[2])*hRcp;                       \
                                                                                 \
     /* Start of quad rasterization */                                           \
-    const sw_texture_t *tex;                                                    \
+    const sw_texture_t *tex = NULL;                                             \
     if (ENABLE_TEXTURE) tex = &RLSW.loadedTextures[RLSW.currentTexture];        \
                                                                                 \
     void *cDstBase = RLSW.framebuffer.color;                                    \
@@ -3044,8 +3764,19 @@ static inline void FUNC_NAME(void)
         v0->color[3]                                                            \
     };                                                                          \
                                                                                 \
-    for (int y = yMin; y < yMax; y++)                                           \
+    SWfilter filter = SW_NEAREST;                                               \
+    if (ENABLE_TEXTURE) filter = sw_texture_get_filter(tex, tcDx[0], tcDy[0], tcDx[1], tcDy[1]); \
+                                                                                \
+    sw_v4_t cDxV = sw_v4_load(cDx);                                             \
+                                                                                \
+    /* Rows above and columns left of the tile only step the interpolation */   \
+    int xEnd = (xMax < tile->xMax)? xMax : tile->xMax;                          \
+    int yEnd = (yMax < tile->yMax)? yMax : tile->yMax;                          \
+                                                                                \
+    for (int y = yMin; y < yEnd; y++)                                           \
     {                                                                           \
+        if (y < tile->yMin) goto skip;                                          \
+                                                                                \
         void *cptr = sw_framebuffer_get_color_addr(cDstBase, y*wDst + xMin);    \
         void *dptr = sw_framebuffer_get_depth_addr(dDstBase, y*wDst + xMin);    \
                                                                                 \
@@ -3053,16 +3784,13 @@ static inline void FUNC_NAME(void)
         float u = uScanline;                                                    \
         float v = vScanline;                                                    \
                                                                                 \
-        float color[4] = {                                                      \
-            colorScanline[0],                                                   \
-            colorScanline[1],                                                   \
-            colorScanline[2],                                                   \
-            colorScanline[3]                                                    \
-        };                                                                      \
+        sw_v4_t color = sw_v4_load(colorScanline);                              \
                                                                                 \
         /* Scanline rasterization */                                            \
-        for (int x = xMin; x < xMax; x++)                                       \
+        for (int x = xMin; x < xEnd; x++)                                       \
         {                                                                       \
+            if (x < tile->xMin) goto discard;                                   \
+                                                                                \
             /* Test and write depth */                                          \
             if (ENABLE_DEPTH_TEST)                                              \
             {                                                                   \
@@ -3074,44 +3802,12 @@ static inline void FUNC_NAME(void)
             sw_framebuffer_write_depth(dptr, z);                                \
                                                                                 \
             /* Pixel color computation */                                       \
-            float srcColor[4] = {                                               \
-                color[0],                                                       \
-                color[1],                                                       \
-                color[2],                                                       \
-                color[3]                                                        \
-            };                                                                  \
-                                                                                \
-            if (ENABLE_TEXTURE)                                                 \
-            {                                                                   \
-                float texColor[4];                                              \
-                sw_texture_sample(texColor, tex, u, v, tcDx[0], tcDy[0], tcDx[1], tcDy[1]); \
-                srcColor[0] *= texColor[0];                                     \
-                srcColor[1] *= texColor[1];                                     \
-                srcColor[2] *= texColor[2];                                     \
-                srcColor[3] *= texColor[3];                                     \
-            }                                                                   \
-                                                                                \
-            if (ENABLE_COLOR_BLEND)                                             \
-            {                                                                   \
-                float dstColor[4];                                              \
-                sw_framebuffer_read_color(dstColor, cptr);                      \
-                                                                                \
-                sw_blend_colors(dstColor, srcColor);                            \
-                dstColor[0] = sw_saturate(dstColor[0]);                         \
-                dstColor[1] = sw_saturate(dstColor[1]);                         \
-                dstColor[2] = sw_saturate(dstColor[2]);                         \
-                dstColor[3] = sw_saturate(dstColor[3]);                         \
-                                                                                \
-                sw_framebuffer_write_color(cptr, dstColor);                     \
-            }                                                                   \
-            else sw_framebuffer_write_color(cptr, srcColor);                    \
+            sw_shade_pixel(cptr, color, tex, filter, u, v,                      \
+                           ENABLE_TEXTURE, ENABLE_COLOR_BLEND);                 \
                                                                                 \
         discard:                                                                \
             z += zDx;                                                           \
-            color[0] += cDx[0];                                                 \
-            color[1] += cDx[1];                                                 \
-            color[2] += cDx[2];                                                 \
-            color[3] += cDx[3];                                                 \
+            color = sw_v4_add(color, cDxV);                                     \
                                                                                 \
             if (ENABLE_TEXTURE)                                                 \
             {                                                                   \
@@ -3123,6 +3819,7 @@ static inline void FUNC_NAME(void)
             sw_framebuffer_inc_depth_addr(&dptr);                               \
         }                                                                       \
                                                                                 \
+    skip:                                                                       \
         zScanline += zDy;                                                       \
         colorScanline[0] += cDy[0];                                             \
         colorScanline[1] += cDy[1];                                             \
@@ -3146,6 +3843,162 @@ DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_TEX_BLEND, 1, 0, 1)
 DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_DEPTH_BLEND, 0, 1, 1)
 DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_TEX_DEPTH_BLEND, 1, 1, 1)
 
+#if defined(SW_INTEGER_2D_RGB8)
+// Integer variant for uniformly colored quads, see sw_shade_pixel_rgba8()
+// NOTE: Coverage and depth are computed as in DEFINE_QUAD_RASTER_AXIS_ALIGNED
+#define DEFINE_QUAD_RASTER_RGBA8(FUNC_NAME, ENABLE_TEXTURE, ENABLE_COLOR_BLEND)     \
+static inline void FUNC_NAME(const sw_vertex_t *vertices, const sw_tile_t *tile)   \
+{                                                                               \
+    const sw_vertex_t *sortedVerts[4];                                          \
+    sw_quad_sort_cw(vertices, sortedVerts);                                     \
+                                                                                \
+    const sw_vertex_t *v0 = sortedVerts[0];                                     \
+    const sw_vertex_t *v1 = sortedVerts[1];                                     \
+    const sw_vertex_t *v2 = sortedVerts[2];                                     \
+    const sw_vertex_t *v3 = sortedVerts[3];                                     \
+                                                                                \
+    /* Screen bounds (axis-aligned) */                                          \
+    int xMin = (int)(v0->screen[0] + 0.5f);                                     \
+    int yMin = (int)(v0->screen[1] + 0.5f);                                     \
+    int xMax = (int)(v2->screen[0] + 0.5f);                                     \
+    int yMax = (int)(v2->screen[1] + 0.5f);                                     \
+                                                                                \
+    int width = xMax - xMin;                                                    \
+    int height = yMax - yMin;                                                   \
+                                                                                \
+    if (width == 0 || height == 0) return;                                      \
+    if ((yMin >= tile->yMax) || (yMax <= tile->yMin)) return;                   \
+    if ((xMin >= tile->xMax) || (xMax <= tile->xMin)) return;                   \
+                                                                                \
+    float wRcp = (width > 0.0f)? 1.0f/width : 0.0f;                             \
+    float hRcp = (height > 0.0f)? 1.0f/height : 0.0f;                           \
+                                                                                \
+    float zDx = (v1->homogeneous[2] - v0->homogeneous[2])*wRcp;                 \
+    float zDy = (v3->homogeneous[2] - v0->homogeneous[2])*hRcp;                 \
+                                                                                \
+    uint8_t tint[4];                                                            \
+    bool tinted = sw_integer_2d_tint(tint, v0->color);                          \
+                                                                                \
+    /* Texel coordinates stepped in 32.32 fixed point. The texture parameters */ \
+    /* are copied to locals, the byte stores below would force reloads */       \
+    const uint8_t *texPixels = NULL;                                            \
+    int texWidth = 0, texHeight = 0;                                            \
+    bool sRepeat = false, tRepeat = false;                                      \
+    int64_t sScanline = 0, tScanline = 0;                                       \
+    int64_t sDx = 0, tDx = 0, sDy = 0, tDy = 0;                                 \
+    if (ENABLE_TEXTURE)                                                         \
+    {                                                                           \
+        const sw_texture_t *tex = &RLSW.loadedTextures[RLSW.currentTexture];    \
+        texPixels = (const uint8_t *)tex->pixels.cptr;                          \
+        texWidth = tex->width;                                                  \
+        texHeight = tex->height;                                                \
+        sRepeat = (tex->sWrap == SW_REPEAT);                                    \
+        tRepeat = (tex->tWrap == SW_REPEAT);                                    \
+        sScanline = sw_texel_start_fixed(v0->texcoord[0], texWidth);            \
+        tScanline = sw_texel_start_fixed(v0->texcoord[1], texHeight);           \
+        sDx = sw_texel_step_fixed(v1->texcoord[0] - v0->texcoord[0], width, texWidth);   \
+        tDx = sw_texel_step_fixed(v1->texcoord[1] - v0->texcoord[1], width, texHeight);  \
+        sDy = sw_texel_step_fixed(v3->texcoord[0] - v0->texcoord[0], height, texWidth);  \
+        tDy = sw_texel_step_fixed(v3->texcoord[1] - v0->texcoord[1], height, texHeight); \
+    }                                                                           \
+                                                                                \
+    uint8_t *cDstBase = (uint8_t *)RLSW.framebuffer.color;                      \
+    void *dDstBase = RLSW.framebuffer.depth;                                    \
+    int wDst = RLSW.framebuffer.width;                                          \
+                                                                                \
+    float zScanline = v0->homogeneous[2];                                       \
+                                                                                \
+    /* Rows above and columns left of the tile only step the interpolation */   \
+    int xFirst = (xMin > tile->xMin)? xMin : tile->xMin;                        \
+    int xEnd = (xMax < tile->xMax)? xMax : tile->xMax;                          \
+    int yEnd = (yMax < tile->yMax)? yMax : tile->yMax;                          \
+                                                                                \
+    for (int y = yMin; y < yEnd; y++)                                           \
+    {                                                                           \
+        if (y >= tile->yMin)                                                    \
+        {                                                                       \
+            uint8_t *cptr = cDstBase + 3*(y*wDst + xFirst);                     \
+            void *dptr = sw_framebuffer_get_depth_addr(dDstBase, y*wDst + xFirst); \
+                                                                                \
+            float z = zScanline;                                                \
+            int64_t s = sScanline;                                              \
+            int64_t t = tScanline;                                              \
+                                                                                \
+            for (int x = xMin; x < xFirst; x++) z += zDx;                       \
+            if (ENABLE_TEXTURE)                                                 \
+            {                                                                   \
+                s += (int64_t)(xFirst - xMin)*sDx;                              \
+                t += (int64_t)(xFirst - xMin)*tDx;                              \
+            }                                                                   \
+                                                                                \
+            /* Sprites only step s along a row, t picks the texel row once */   \
+            int texRow = 0;                                                     \
+            if (ENABLE_TEXTURE) texRow = sw_texel_wrap(t, texHeight, tRepeat)*texWidth; \
+                                                                                \
+            for (int x = xFirst; x < xEnd; x++)                                 \
+            {                                                                   \
+                sw_framebuffer_write_depth(dptr, z);                            \
+                                                                                \
+                const uint8_t *texel = NULL;                                    \
+                if (ENABLE_TEXTURE)                                             \
+                {                                                               \
+                    if (tDx != 0) texRow = sw_texel_wrap(t, texHeight, tRepeat)*texWidth; \
+                    texel = texPixels + 4*(texRow + sw_texel_wrap(s, texWidth, sRepeat)); \
+                }                                                               \
+                                                                                \
+                sw_shade_pixel_rgba8(cptr, tint, tinted, texel,                 \
+                                     ENABLE_TEXTURE, ENABLE_COLOR_BLEND);       \
+                                                                                \
+                z += zDx;                                                       \
+                if (ENABLE_TEXTURE)                                             \
+                {                                                               \
+                    s += sDx;                                                   \
+                    t += tDx;                                                   \
+                }                                                               \
+                                                                                \
+                cptr += 3;                                                      \
+                sw_framebuffer_inc_depth_addr(&dptr);                           \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        zScanline += zDy;                                                       \
+        if (ENABLE_TEXTURE)                                                     \
+        {                                                                       \
+            sScanline += sDy;                                                   \
+            tScanline += tDy;                                                   \
+        }                                                                       \
+    }                                                                           \
+}
+
+DEFINE_QUAD_RASTER_RGBA8(sw_quad_raster_RGBA8, 0, 0)
+DEFINE_QUAD_RASTER_RGBA8(sw_quad_raster_RGBA8_TEX, 1, 0)
+DEFINE_QUAD_RASTER_RGBA8(sw_quad_raster_RGBA8_BLEND, 0, 1)
+DEFINE_QUAD_RASTER_RGBA8(sw_quad_raster_RGBA8_TEX_BLEND, 1, 1)
+#endif // SW_INTEGER_2D_RGB8
+
+static inline void sw_quad_rasterize(const sw_vertex_t *vertices, const sw_tile_t *tile)
+{
+#if defined(SW_INTEGER_2D_RGB8)
+    if (sw_integer_2d_state_check() && sw_integer_2d_vertex_check(vertices, 4))
+    {
+        if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) sw_quad_raster_RGBA8_TEX_BLEND(vertices, tile);
+        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_quad_raster_RGBA8_BLEND(vertices, tile);
+        else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D)) sw_quad_raster_RGBA8_TEX(vertices, tile);
+        else sw_quad_raster_RGBA8(vertices, tile);
+        return;
+    }
+#endif
+
+    if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_TEX_DEPTH_BLEND(vertices, tile);
+    else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_DEPTH_BLEND(vertices, tile);
+    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_TEX_BLEND(vertices, tile);
+    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST)) sw_quad_raster_axis_aligned_TEX_DEPTH(vertices, tile);
+    else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_quad_raster_axis_aligned_BLEND(vertices, tile);
+    else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_quad_raster_axis_aligned_DEPTH(vertices, tile);
+    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D)) sw_quad_raster_axis_aligned_TEX(vertices, tile);
+    else sw_quad_raster_axis_aligned(vertices, tile);
+}
+
 static inline void sw_quad_render(void)
 {
     if (RLSW.stateFlags & SW_STATE_CULL_FACE)
@@ -3159,40 +4012,9 @@ static inline void sw_quad_render(void)
 
     if (RLSW.vertexCounter == 4 && sw_quad_is_axis_aligned())
     {
-        if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_TEX_DEPTH_BLEND();
-        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_DEPTH_BLEND();
-        else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_TEX_BLEND();
-        else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST)) sw_quad_raster_axis_aligned_TEX_DEPTH();
-        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_quad_raster_axis_aligned_BLEND();
-        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_quad_raster_axis_aligned_DEPTH();
-        else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D)) sw_quad_raster_axis_aligned_TEX();
-        else sw_quad_raster_axis_aligned();
-        return;
-    }
-
-    #define TRIANGLE_RASTER(RASTER_FUNC)                        \
-    {                                                           \
-        for (int i = 0; i < RLSW.vertexCounter - 2; i++)        \
-        {                                                       \
-            RASTER_FUNC(                                        \
-                &RLSW.vertexBuffer[0],                          \
-                &RLSW.vertexBuffer[i + 1],                      \
-                &RLSW.vertexBuffer[i + 2],                      \
-                &RLSW.loadedTextures[RLSW.currentTexture]       \
-            );                                                  \
-        }                                                       \
+        sw_primitive_submit(SW_PRIMITIVE_QUAD_AXIS_ALIGNED, RLSW.vertexBuffer, 4);
     }
-
-    if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH_BLEND)
-    else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_DEPTH_BLEND)
-    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_TEX_BLEND)
-    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST)) TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH)
-    else if (SW_STATE_CHECK(SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_BLEND)
-    else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) TRIANGLE_RASTER(sw_triangle_raster_DEPTH)
-    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D)) TRIANGLE_RASTER(sw_triangle_raster_TEX)
-    else TRIANGLE_RASTER(sw_triangle_raster)
-
-    #undef TRIANGLE_RASTER
+    else sw_primitive_submit(SW_PRIMITIVE_POLYGON, RLSW.vertexBuffer, RLSW.vertexCounter);
 }
 
 // Line rendering logic
@@ -3293,7 +4115,7 @@ static inline bool sw_line_clip_and_project(sw_vertex_t *v0, sw_vertex_t *v1)
 }
 
 #define DEFINE_LINE_RASTER(FUNC_NAME, ENABLE_DEPTH_TEST, ENABLE_COLOR_BLEND) \
-static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1) \
+static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1, const sw_tile_t *tile) \
 {                                                                       \
     int x1 = (int)(v0->screen[0] + 0.5f);                               \
     int y1 = (int)(v0->screen[1] + 0.5f);                               \
@@ -3359,6 +4181,9 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1) \
     {                                                                   \
         for (int i = 0; i != longLen; i += sgnInc)                      \
         {                                                               \
+            if (((y1 + i) < tile->yMin) || ((y1 + i) >= tile->yMax)) goto discardA; \
+            if (((x1 + (j >> 16)) < tile->xMin) || ((x1 + (j >> 16)) >= tile->xMax)) goto discardA; \
+                                                                        \
             int offset = (y1 + i)*fbWidth + (x1 + (j >> 16));           \
             void *dptr = sw_framebuffer_get_depth_addr(dBuffer, offset); \
                                                                         \
@@ -3395,6 +4220,9 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1) \
     {                                                                   \
         for (int i = 0; i != longLen; i += sgnInc)                      \
         {                                                               \
+            if (((y1 + (j >> 16)) < tile->yMin) || ((y1 + (j >> 16)) >= tile->yMax)) goto discardB; \
+            if (((x1 + i) < tile->xMin) || ((x1 + i) >= tile->xMax)) goto discardB; \
+                                                                        \
             int offset = (y1 + (j >> 16))*fbWidth + (x1 + i);           \
             void *dptr = sw_framebuffer_get_depth_addr(dBuffer, offset); \
                                                                         \
@@ -3430,7 +4258,7 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1) \
 }
 
 #define DEFINE_LINE_THICK_RASTER(FUNC_NAME, RASTER_FUNC)                \
-void FUNC_NAME(const sw_vertex_t *v1, const sw_vertex_t *v2)            \
+void FUNC_NAME(const sw_vertex_t *v1, const sw_vertex_t *v2, const sw_tile_t *tile) \
 {                                                                       \
     sw_vertex_t tv1, tv2;                                               \
                                                                         \
@@ -3442,7 +4270,7 @@ void FUNC_NAME(const sw_vertex_t *v1, const sw_vertex_t *v2)            \
     int dx = x2 - x1;                                                   \
     int dy = y2 - y1;                                                   \
                                                                         \
-    RASTER_FUNC(v1, v2);                                                \
+    RASTER_FUNC(v1, v2, tile);                                          \
                                                                         \
     if (dx != 0 && abs(dy/dx) < 1)                                      \
     {                                                                   \
@@ -3453,11 +4281,11 @@ void FUNC_NAME(const sw_vertex_t *v1, const sw_vertex_t *v2)            \
             tv1 = *v1, tv2 = *v2;                                       \
             tv1.screen[1] -= i;                                         \
             tv2.screen[1] -= i;                                         \
-            RASTER_FUNC(&tv1, &tv2);                                    \
+            RASTER_FUNC(&tv1, &tv2, tile);                              \
             tv1 = *v1, tv2 = *v2;                                       \
             tv1.screen[1] += i;                                         \
             tv2.screen[1] += i;                                         \
-            RASTER_FUNC(&tv1, &tv2);                                    \
+            RASTER_FUNC(&tv1, &tv2, tile);                              \
         }                                                               \
     }                                                                   \
     else if (dy != 0)                                                   \
@@ -3469,11 +4297,11 @@ void FUNC_NAME(const sw_vertex_t *v1, const sw_vertex_t *v2)            \
             tv1 = *v1, tv2 = *v2;                                       \
             tv1.screen[0] -= i;                                         \
             tv2.screen[0] -= i;                                         \
-            RASTER_FUNC(&tv1, &tv2);                                    \
+            RASTER_FUNC(&tv1, &tv2, tile);                              \
             tv1 = *v1, tv2 = *v2;                                       \
             tv1.screen[0] += i;                                         \
             tv2.screen[0] += i;                                         \
-            RASTER_FUNC(&tv1, &tv2);                                    \
+            RASTER_FUNC(&tv1, &tv2, tile);                              \
         }                                                               \
     }                                                                   \
 }
@@ -3488,191 +4316,1130 @@ DEFINE_LINE_THICK_RASTER(sw_line_thick_raster_DEPTH, sw_line_raster_DEPTH)
 DEFINE_LINE_THICK_RASTER(sw_line_thick_raster_BLEND, sw_line_raster_BLEND)
 DEFINE_LINE_THICK_RASTER(sw_line_thick_raster_DEPTH_BLEND, sw_line_raster_DEPTH_BLEND)
 
-static inline void sw_line_render(sw_vertex_t *vertices)
+static inline void sw_line_rasterize(const sw_vertex_t *v0, const sw_vertex_t *v1, const sw_tile_t *tile)
+{
+    if (RLSW.lineWidth >= 2.0f)
+    {
+        if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_line_thick_raster_DEPTH_BLEND(v0, v1, tile);
+        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_line_thick_raster_BLEND(v0, v1, tile);
+        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_line_thick_raster_DEPTH(v0, v1, tile);
+        else sw_line_thick_raster(v0, v1, tile);
+    }
+    else
+    {
+        if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_line_raster_DEPTH_BLEND(v0, v1, tile);
+        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_line_raster_BLEND(v0, v1, tile);
+        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_line_raster_DEPTH(v0, v1, tile);
+        else sw_line_raster(v0, v1, tile);
+    }
+}
+
+static inline void sw_line_render(sw_vertex_t *vertices)
+{
+    if (!sw_line_clip_and_project(&vertices[0], &vertices[1])) return;
+
+    sw_primitive_submit(SW_PRIMITIVE_LINE, vertices, 2);
+}
+
+// Point rendering logic
+
+static inline bool sw_point_clip_and_project(sw_vertex_t *v)
+{
+    if (v->homogeneous[3] != 1.0f)
+    {
+        for (int_fast8_t i = 0; i < 3; i++)
+        {
+            if ((v->homogeneous[i] < -v->homogeneous[3]) || (v->homogeneous[i] > v->homogeneous[3])) return false;
+        }
+
+        v->homogeneous[3] = 1.0f/v->homogeneous[3];
+        v->homogeneous[0] *= v->homogeneous[3];
+        v->homogeneous[1] *= v->homogeneous[3];
+        v->homogeneous[2] *= v->homogeneous[3];
+    }
+
+    sw_project_ndc_to_screen(v->screen, v->homogeneous);
+
+    const int *min = NULL, *max = NULL;
+
+    if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
+    {
+        min = RLSW.scMin;
+        max = RLSW.scMax;
+    }
+    else
+    {
+        min = RLSW.vpMin;
+        max = RLSW.vpMax;
+    }
+
+    bool insideX = (v->screen[0] - RLSW.pointRadius < max[0]) && (v->screen[0] + RLSW.pointRadius > min[0]);
+    bool insideY = (v->screen[1] - RLSW.pointRadius < max[1]) && (v->screen[1] + RLSW.pointRadius > min[1]);
+
+    return (insideX && insideY);
+}
+
+#define DEFINE_POINT_RASTER(FUNC_NAME, ENABLE_DEPTH_TEST, ENABLE_COLOR_BLEND, CHECK_BOUNDS) \
+static inline void FUNC_NAME(int x, int y, float z, const float color[4], const sw_tile_t *tile) \
+{                                                                           \
+    if ((y < tile->yMin) || (y >= tile->yMax)) return;                      \
+    if ((x < tile->xMin) || (x >= tile->xMax)) return;                      \
+                                                                            \
+    if (CHECK_BOUNDS == 1)                                                  \
+    {                                                                       \
+        if (x < RLSW.vpMin[0] || x >= RLSW.vpMax[0]) return;                \
+        if (y < RLSW.vpMin[1] || y >= RLSW.vpMax[1]) return;                \
+    }                                                                       \
+    else if (CHECK_BOUNDS == SW_SCISSOR_TEST)                               \
+    {                                                                       \
+        if (x < RLSW.scMin[0] || x >= RLSW.scMax[0]) return;                \
+        if (y < RLSW.scMin[1] || y >= RLSW.scMax[1]) return;                \
+    }                                                                       \
+                                                                            \
+    int offset = y*RLSW.framebuffer.width + x;                              \
+                                                                            \
+    void *dptr = sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, offset); \
+                                                                            \
+    if (ENABLE_DEPTH_TEST)                                                  \
+    {                                                                       \
+        float depth = sw_framebuffer_read_depth(dptr);                      \
+        if (z > depth) return;                                              \
+    }                                                                       \
+                                                                            \
+    sw_framebuffer_write_depth(dptr, z);                                    \
+                                                                            \
+    void *cptr = sw_framebuffer_get_color_addr(RLSW.framebuffer.color, offset); \
+                                                                            \
+    if (ENABLE_COLOR_BLEND)                                                 \
+    {                                                                       \
+        float dstColor[4];                                                  \
+        sw_framebuffer_read_color(dstColor, cptr);                          \
+                                                                            \
+        sw_blend_colors(dstColor, color);                                   \
+        sw_framebuffer_write_color(cptr, dstColor);                         \
+    }                                                                       \
+    else sw_framebuffer_write_color(cptr, color);                           \
+}
+
+#define DEFINE_POINT_THICK_RASTER(FUNC_NAME, RASTER_FUNC)                   \
+static inline void FUNC_NAME(const sw_vertex_t *v, const sw_tile_t *tile)   \
+{                                                                           \
+    int cx = v->screen[0];                                                  \
+    int cy = v->screen[1];                                                  \
+    float cz = v->homogeneous[2];                                           \
+    int radius = RLSW.pointRadius;                                          \
+    const float *color = v->color;                                          \
+                                                                            \
+    int x = 0;                                                              \
+    int y = radius;                                                         \
+    int d = 3 - 2*radius;                                                   \
+                                                                            \
+    while (x <= y)                                                          \
+    {                                                                       \
+        for (int i = -x; i <= x; i++)                                       \
+        {                                                                   \
+            RASTER_FUNC(cx + i, cy + y, cz, color, tile);                   \
+            RASTER_FUNC(cx + i, cy - y, cz, color, tile);                   \
+        }                                                                   \
+        for (int i = -y; i <= y; i++)                                       \
+        {                                                                   \
+            RASTER_FUNC(cx + i, cy + x, cz, color, tile);                   \
+            RASTER_FUNC(cx + i, cy - x, cz, color, tile);                   \
+        }                                                                   \
+        if (d > 0)                                                          \
+        {                                                                   \
+            y--;                                                            \
+            d = d + 4*(x - y) + 10;                                         \
+        }                                                                   \
+        else d = d + 4*x + 6;                                               \
+        x++;                                                                \
+    }                                                                       \
+}
+
+DEFINE_POINT_RASTER(sw_point_raster, 0, 0, 0)
+DEFINE_POINT_RASTER(sw_point_raster_DEPTH, 1, 0, 0)
+DEFINE_POINT_RASTER(sw_point_raster_BLEND, 0, 1, 0)
+DEFINE_POINT_RASTER(sw_point_raster_DEPTH_BLEND, 1, 1, 0)
+
+DEFINE_POINT_RASTER(sw_point_raster_CHECK, 0, 0, 1)
+DEFINE_POINT_RASTER(sw_point_raster_DEPTH_CHECK, 1, 0, 1)
+DEFINE_POINT_RASTER(sw_point_raster_BLEND_CHECK, 0, 1, 1)
+DEFINE_POINT_RASTER(sw_point_raster_DEPTH_BLEND_CHECK, 1, 1, 1)
+
+DEFINE_POINT_RASTER(sw_point_raster_CHECK_SCISSOR, 0, 0, SW_SCISSOR_TEST)
+DEFINE_POINT_RASTER(sw_point_raster_DEPTH_CHECK_SCISSOR, 1, 0, SW_SCISSOR_TEST)
+DEFINE_POINT_RASTER(sw_point_raster_BLEND_CHECK_SCISSOR, 0, 1, SW_SCISSOR_TEST)
+DEFINE_POINT_RASTER(sw_point_raster_DEPTH_BLEND_CHECK_SCISSOR, 1, 1, SW_SCISSOR_TEST)
+
+DEFINE_POINT_THICK_RASTER(sw_point_thick_raster, sw_point_raster_CHECK)
+DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_DEPTH, sw_point_raster_DEPTH_CHECK)
+DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_BLEND, sw_point_raster_BLEND_CHECK)
+DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_DEPTH_BLEND, sw_point_raster_DEPTH_BLEND_CHECK)
+
+DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_SCISSOR, sw_point_raster_CHECK_SCISSOR)
+DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_DEPTH_SCISSOR, sw_point_raster_DEPTH_CHECK_SCISSOR)
+DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_BLEND_SCISSOR, sw_point_raster_BLEND_CHECK_SCISSOR)
+DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_DEPTH_BLEND_SCISSOR, sw_point_raster_DEPTH_BLEND_CHECK_SCISSOR)
+
+static inline void sw_point_rasterize(const sw_vertex_t *v, const sw_tile_t *tile)
+{
+    if (RLSW.pointRadius >= 1.0f)
+    {
+        if (SW_STATE_CHECK(SW_STATE_SCISSOR_TEST))
+        {
+            if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_point_thick_raster_DEPTH_BLEND_SCISSOR(v, tile);
+            else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_point_thick_raster_BLEND_SCISSOR(v, tile);
+            else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_point_thick_raster_DEPTH_SCISSOR(v, tile);
+            else sw_point_thick_raster_SCISSOR(v, tile);
+        }
+        else
+        {
+            if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_point_thick_raster_DEPTH_BLEND(v, tile);
+            else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_point_thick_raster_BLEND(v, tile);
+            else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_point_thick_raster_DEPTH(v, tile);
+            else sw_point_thick_raster(v, tile);
+        }
+    }
+    else
+    {
+        if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_point_raster_DEPTH_BLEND(v->screen[0], v->screen[1], v->homogeneous[2], v->color, tile);
+        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_point_raster_BLEND(v->screen[0], v->screen[1], v->homogeneous[2], v->color, tile);
+        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_point_raster_DEPTH(v->screen[0], v->screen[1], v->homogeneous[2], v->color, tile);
+        else sw_point_raster(v->screen[0], v->screen[1], v->homogeneous[2], v->color, tile);
+    }
+}
+
+static inline void sw_point_render(sw_vertex_t *v)
+{
+    if (!sw_point_clip_and_project(v)) return;
+
+    sw_primitive_submit(SW_PRIMITIVE_POINT, v, 1);
+}
+
+// Primitive submission and tile binning logic
+
+static inline void sw_primitive_rasterize(sw_primitive_type_t type, const sw_vertex_t *vertices, int vertexCount, const sw_tile_t *tile)
+{
+    switch (type)
+    {
+        case SW_PRIMITIVE_POLYGON: sw_polygon_rasterize(vertices, vertexCount, tile); break;
+        case SW_PRIMITIVE_QUAD_AXIS_ALIGNED: sw_quad_rasterize(vertices, tile); break;
+        case SW_PRIMITIVE_LINE: sw_line_rasterize(&vertices[0], &vertices[1], tile); break;
+        case SW_PRIMITIVE_POINT: sw_point_rasterize(&vertices[0], tile); break;
+    }
+}
+
+#if (SW_RASTER_THREADS != 1)
+
+static inline void sw_mutex_lock(sw_mutex_t *mutex)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive((struct _RTL_SRWLOCK *)mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+static inline void sw_mutex_unlock(sw_mutex_t *mutex)
+{
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive((struct _RTL_SRWLOCK *)mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+static inline void sw_cond_wait(sw_cond_t *cond, sw_mutex_t *mutex)
+{
+#if defined(_WIN32)
+    SleepConditionVariableSRW((struct _RTL_CONDITION_VARIABLE *)cond, (struct _RTL_SRWLOCK *)mutex, 0xFFFFFFFF, 0);
+#else
+    pthread_cond_wait(cond, mutex);
+#endif
+}
+
+static inline void sw_cond_broadcast(sw_cond_t *cond)
+{
+#if defined(_WIN32)
+    WakeAllConditionVariable((struct _RTL_CONDITION_VARIABLE *)cond);
+#else
+    pthread_cond_broadcast(cond);
+#endif
+}
+
+static int sw_get_cpu_count(void)
+{
+    int count = 1;
+#if defined(_WIN32)
+    count = (int)GetActiveProcessorCount(0xFFFF);   // ALL_PROCESSOR_GROUPS
+#elif defined(_SC_NPROCESSORS_ONLN)
+    count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return (count > 0)? count : 1;
+}
+
+// Rasterize the binned primitives of the tiles claimed by the calling thread
+static void sw_raster_run_tiles(void)
+{
+    while (true)
+    {
+        sw_mutex_lock(&RLSW.raster.lock);
+        int t = RLSW.raster.nextTile++;
+        sw_mutex_unlock(&RLSW.raster.lock);
+
+        if (t >= RLSW.raster.tileCount) break;
+
+        const sw_tile_bin_t *bin = &RLSW.raster.bins[t];
+
+        for (int i = 0; i < bin->count; i++)
+        {
+            const sw_primitive_t *primitive = &RLSW.raster.primitives[bin->primitives[i]];
+            sw_primitive_rasterize(primitive->type, &RLSW.raster.vertices[primitive->firstVertex], primitive->vertexCount, &bin->tile);
+        }
+    }
+}
+
+static SW_THREAD_RESULT sw_raster_worker(void *param)
+{
+    (void)param;
+    uint32_t generation = 0;
+
+    sw_mutex_lock(&RLSW.raster.lock);
+    while (true)
+    {
+        while (!RLSW.raster.quit && (RLSW.raster.generation == generation)) sw_cond_wait(&RLSW.raster.workCond, &RLSW.raster.lock);
+        if (RLSW.raster.quit) break;
+
+        generation = RLSW.raster.generation;
+        sw_mutex_unlock(&RLSW.raster.lock);
+
+        sw_raster_run_tiles();
+
+        sw_mutex_lock(&RLSW.raster.lock);
+        if (--RLSW.raster.pendingWorkers == 0) sw_cond_broadcast(&RLSW.raster.doneCond);
+    }
+    sw_mutex_unlock(&RLSW.raster.lock);
+
+    return 0;
+}
+
+static bool sw_raster_threads_start(int threadCount)
+{
+#if !defined(_WIN32)
+    if (pthread_mutex_init(&RLSW.raster.lock, NULL) != 0) return false;
+    if (pthread_cond_init(&RLSW.raster.workCond, NULL) != 0) { pthread_mutex_destroy(&RLSW.raster.lock); return false; }
+    if (pthread_cond_init(&RLSW.raster.doneCond, NULL) != 0)
+    {
+        pthread_cond_destroy(&RLSW.raster.workCond);
+        pthread_mutex_destroy(&RLSW.raster.lock);
+        return false;
+    }
+#endif
+
+    RLSW.raster.workerCount = 0;
+    RLSW.raster.quit = false;
+
+    for (int i = 0; i < threadCount - 1; i++)
+    {
+#if defined(_WIN32)
+        RLSW.raster.threads[i] = CreateThread(NULL, 0, sw_raster_worker, NULL, 0, NULL);
+        if (RLSW.raster.threads[i] == NULL) break;
+#else
+        if (pthread_create(&RLSW.raster.threads[i], NULL, sw_raster_worker, NULL) != 0) break;
+#endif
+        RLSW.raster.workerCount++;
+    }
+
+    // The calling thread always takes part, fewer workers only means less parallelism
+    RLSW.raster.threadCount = RLSW.raster.workerCount + 1;
+
+    return true;
+}
+
+static void sw_raster_threads_stop(void)
+{
+    sw_mutex_lock(&RLSW.raster.lock);
+    RLSW.raster.quit = true;
+    sw_cond_broadcast(&RLSW.raster.workCond);
+    sw_mutex_unlock(&RLSW.raster.lock);
+
+    for (int i = 0; i < RLSW.raster.workerCount; i++)
+    {
+#if defined(_WIN32)
+        WaitForSingleObject(RLSW.raster.threads[i], 0xFFFFFFFF);
+        CloseHandle(RLSW.raster.threads[i]);
+#else
+        pthread_join(RLSW.raster.threads[i], NULL);
+#endif
+    }
+
+#if !defined(_WIN32)
+    pthread_cond_destroy(&RLSW.raster.doneCond);
+    pthread_cond_destroy(&RLSW.raster.workCond);
+    pthread_mutex_destroy(&RLSW.raster.lock);
+#endif
+
+    RLSW.raster.workerCount = 0;
+    RLSW.raster.threadCount = 1;
+}
+
+static void sw_raster_free(void)
+{
+    for (int i = 0; i < RLSW.raster.binCount; i++) SW_FREE(RLSW.raster.bins[i].primitives);
+
+    SW_FREE(RLSW.raster.bins);
+    SW_FREE(RLSW.raster.primitives);
+    SW_FREE(RLSW.raster.vertices);
+
+    RLSW.raster.bins = NULL;
+    RLSW.raster.primitives = NULL;
+    RLSW.raster.vertices = NULL;
+    RLSW.raster.binCount = 0;
+    RLSW.raster.primitiveCapacity = 0;
+    RLSW.raster.vertexCapacity = 0;
+}
+
+static bool sw_raster_bins_grow(int tileCount)
+{
+    if (tileCount > RLSW.raster.binCount)
+    {
+        sw_tile_bin_t *bins = SW_REALLOC(RLSW.raster.bins, tileCount*sizeof(sw_tile_bin_t));
+        if (bins == NULL) return false;
+
+        for (int i = RLSW.raster.binCount; i < tileCount; i++) bins[i] = (sw_tile_bin_t) { 0 };
+
+        RLSW.raster.bins = bins;
+        RLSW.raster.binCount = tileCount;
+    }
+
+    return true;
+}
+
+// Make sure there is one bin per tile of the current framebuffer
+static bool sw_raster_bins_reserve(void)
+{
+    int tileCount = (RLSW.framebuffer.height + SW_RASTER_TILE_HEIGHT - 1)/SW_RASTER_TILE_HEIGHT;
+
+    if (!sw_raster_bins_grow(tileCount)) return false;
+
+    for (int t = 0; t < tileCount; t++)
+    {
+        sw_tile_t *tile = &RLSW.raster.bins[t].tile;
+
+        tile->xMin = 0;
+        tile->yMin = t*SW_RASTER_TILE_HEIGHT;
+        tile->xMax = RLSW.framebuffer.width;
+        tile->yMax = (t + 1)*SW_RASTER_TILE_HEIGHT;
+        if (tile->yMax > RLSW.framebuffer.height) tile->yMax = RLSW.framebuffer.height;
+    }
+
+    RLSW.raster.tileCount = tileCount;
+
+    return true;
+}
+
+static inline bool sw_raster_grow(void **buffer, int *capacity, int required, int elementSize)
+{
+    if (required <= *capacity) return true;
+
+    int newCapacity = (*capacity > 0)? *capacity : 256;
+    while (newCapacity < required) newCapacity *= 2;
+
+    void *newBuffer = SW_REALLOC(*buffer, (size_t)newCapacity*elementSize);
+    if (newBuffer == NULL) return false;
+
+    *buffer = newBuffer;
+    *capacity = newCapacity;
+
+    return true;
+}
+
+// Rasterize the bins on the calling thread and the workers, returns once all tiles are done
+static void sw_raster_run_parallel(void)
+{
+    sw_mutex_lock(&RLSW.raster.lock);
+    RLSW.raster.nextTile = 0;
+    RLSW.raster.pendingWorkers = RLSW.raster.workerCount;
+    RLSW.raster.generation++;
+    sw_cond_broadcast(&RLSW.raster.workCond);
+    sw_mutex_unlock(&RLSW.raster.lock);
+
+    sw_raster_run_tiles();
+
+    sw_mutex_lock(&RLSW.raster.lock);
+    while (RLSW.raster.pendingWorkers > 0) sw_cond_wait(&RLSW.raster.doneCond, &RLSW.raster.lock);
+    sw_mutex_unlock(&RLSW.raster.lock);
+}
+
+// Rasterize everything binned since the last flush, in parallel when the batch is large enough
+static void sw_raster_flush(void)
+{
+    if (RLSW.raster.primitiveCount == 0) return;
+
+    if ((RLSW.raster.threadCount > 1) && (RLSW.raster.area >= SW_RASTER_PARALLEL_MIN_AREA))
+    {
+        sw_raster_run_parallel();
+    }
+    else
+    {
+        // Small batch, waking the workers would cost more than it saves
+        const sw_tile_t tile = { 0, 0, RLSW.framebuffer.width, RLSW.framebuffer.height };
+
+        for (int i = 0; i < RLSW.raster.primitiveCount; i++)
+        {
+            const sw_primitive_t *primitive = &RLSW.raster.primitives[i];
+            sw_primitive_rasterize(primitive->type, &RLSW.raster.vertices[primitive->firstVertex], primitive->vertexCount, &tile);
+        }
+    }
+
+    for (int i = 0; i < RLSW.raster.tileCount; i++) RLSW.raster.bins[i].count = 0;
+
+    RLSW.raster.vertexCount = 0;
+    RLSW.raster.primitiveCount = 0;
+    RLSW.raster.area = 0;
+}
+
+// Copy a primitive into the batch and add it to the bins of the tiles it overlaps
+static bool sw_primitive_bin(sw_primitive_type_t type, const sw_vertex_t *vertices, int vertexCount)
+{
+    // Conservative screen bounds, lines and points are padded by their width
+    float xMin = vertices[0].screen[0], xMax = xMin;
+    float yMin = vertices[0].screen[1], yMax = yMin;
+
+    for (int i = 1; i < vertexCount; i++)
+    {
+        if (vertices[i].screen[0] < xMin) xMin = vertices[i].screen[0];
+        if (vertices[i].screen[0] > xMax) xMax = vertices[i].screen[0];
+        if (vertices[i].screen[1] < yMin) yMin = vertices[i].screen[1];
+        if (vertices[i].screen[1] > yMax) yMax = vertices[i].screen[1];
+    }
+
+    float pad = 1.0f;
+    if (type == SW_PRIMITIVE_LINE) pad += RLSW.lineWidth;
+    else if (type == SW_PRIMITIVE_POINT) pad += RLSW.pointRadius;
+
+    int rowMin = (int)floorf(yMin - pad);
+    int rowMax = (int)ceilf(yMax + pad) + 1;
+    if (rowMin < 0) rowMin = 0;
+    if (rowMax > RLSW.framebuffer.height) rowMax = RLSW.framebuffer.height;
+    if (rowMin >= rowMax) return true;  // Nothing visible
+
+    if (!sw_raster_grow((void **)&RLSW.raster.vertices, &RLSW.raster.vertexCapacity, RLSW.raster.vertexCount + vertexCount, sizeof(sw_vertex_t))) return false;
+    if (!sw_raster_grow((void **)&RLSW.raster.primitives, &RLSW.raster.primitiveCapacity, RLSW.raster.primitiveCount + 1, sizeof(sw_primitive_t))) return false;
+
+    int tileMin = rowMin/SW_RASTER_TILE_HEIGHT;
+    int tileMax = (rowMax - 1)/SW_RASTER_TILE_HEIGHT;
+
+    for (int t = tileMin; t <= tileMax; t++)
+    {
+        sw_tile_bin_t *bin = &RLSW.raster.bins[t];
+        if (!sw_raster_grow((void **)&bin->primitives, &bin->capacity, bin->count + 1, sizeof(int))) return false;
+    }
+
+    int index = RLSW.raster.primitiveCount++;
+    RLSW.raster.primitives[index] = (sw_primitive_t) { type, RLSW.raster.vertexCount, vertexCount };
+
+    for (int i = 0; i < vertexCount; i++) RLSW.raster.vertices[RLSW.raster.vertexCount++] = vertices[i];
+    for (int t = tileMin; t <= tileMax; t++) RLSW.raster.bins[t].primitives[RLSW.raster.bins[t].count++] = index;
+
+    RLSW.raster.area += (int64_t)(xMax - xMin + 2.0f*pad)*(rowMax - rowMin);
+
+    return true;
+}
+
+#if defined(SW_DAMAGE_DEFERRED)
+
+static inline uint64_t sw_hash_mix(uint64_t hash, uint64_t value)
+{
+    hash = (hash ^ value)*0x9E3779B97F4A7C15ULL;
+    return hash ^ (hash >> 32);
+}
+
+static inline uint64_t sw_hash_floats(uint64_t hash, const float *values, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        union { float f; uint32_t u; } bits = { values[i] };
+        hash = sw_hash_mix(hash, bits.u);
+    }
+
+    return hash;
+}
+
+static inline void sw_raster_state_save(sw_raster_state_t *state)
+{
+    state->stateFlags = RLSW.stateFlags;
+    state->texture = RLSW.currentTexture;
+    state->srcFactor = RLSW.srcFactor;
+    state->dstFactor = RLSW.dstFactor;
+    state->srcFactorFunc = RLSW.srcFactorFunc;
+    state->dstFactorFunc = RLSW.dstFactorFunc;
+    state->vpMin[0] = RLSW.vpMin[0];
+    state->vpMin[1] = RLSW.vpMin[1];
+    state->vpMax[0] = RLSW.vpMax[0];
+    state->vpMax[1] = RLSW.vpMax[1];
+    state->scMin[0] = RLSW.scMin[0];
+    state->scMin[1] = RLSW.scMin[1];
+    state->scMax[0] = RLSW.scMax[0];
+    state->scMax[1] = RLSW.scMax[1];
+    state->pointRadius = RLSW.pointRadius;
+    state->lineWidth = RLSW.lineWidth;
+}
+
+static inline void sw_raster_state_load(const sw_raster_state_t *state)
+{
+    RLSW.stateFlags = state->stateFlags;
+    RLSW.currentTexture = state->texture;
+    RLSW.srcFactor = state->srcFactor;
+    RLSW.dstFactor = state->dstFactor;
+    RLSW.srcFactorFunc = state->srcFactorFunc;
+    RLSW.dstFactorFunc = state->dstFactorFunc;
+    RLSW.vpMin[0] = state->vpMin[0];
+    RLSW.vpMin[1] = state->vpMin[1];
+    RLSW.vpMax[0] = state->vpMax[0];
+    RLSW.vpMax[1] = state->vpMax[1];
+    RLSW.scMin[0] = state->scMin[0];
+    RLSW.scMin[1] = state->scMin[1];
+    RLSW.scMax[0] = state->scMax[0];
+    RLSW.scMax[1] = state->scMax[1];
+    RLSW.pointRadius = state->pointRadius;
+    RLSW.lineWidth = state->lineWidth;
+}
+
+// Everything in the state that changes the pixels a batch produces
+static uint64_t sw_raster_state_hash(const sw_raster_state_t *state)
+{
+    uint64_t hash = sw_hash_mix(0, state->stateFlags);
+
+    if (state->stateFlags & SW_STATE_TEXTURE_2D)
+    {
+        hash = sw_hash_mix(hash, state->texture);
+        hash = sw_hash_mix(hash, RLSW.loadedTextures[state->texture].version);
+    }
+
+    hash = sw_hash_mix(hash, state->srcFactor);
+    hash = sw_hash_mix(hash, state->dstFactor);
+    hash = sw_hash_mix(hash, ((uint64_t)(uint32_t)state->vpMin[0] << 32) | (uint32_t)state->vpMin[1]);
+    hash = sw_hash_mix(hash, ((uint64_t)(uint32_t)state->vpMax[0] << 32) | (uint32_t)state->vpMax[1]);
+    hash = sw_hash_mix(hash, ((uint64_t)(uint32_t)state->scMin[0] << 32) | (uint32_t)state->scMin[1]);
+    hash = sw_hash_mix(hash, ((uint64_t)(uint32_t)state->scMax[0] << 32) | (uint32_t)state->scMax[1]);
+    hash = sw_hash_floats(hash, &state->pointRadius, 1);
+    hash = sw_hash_floats(hash, &state->lineWidth, 1);
+
+    return hash;
+}
+
+static inline bool sw_tile_intersect(const sw_tile_t *a, const sw_tile_t *b, sw_tile_t *result)
+{
+    result->xMin = (a->xMin > b->xMin)? a->xMin : b->xMin;
+    result->yMin = (a->yMin > b->yMin)? a->yMin : b->yMin;
+    result->xMax = (a->xMax < b->xMax)? a->xMax : b->xMax;
+    result->yMax = (a->yMax < b->yMax)? a->yMax : b->yMax;
+
+    return (result->xMin < result->xMax) && (result->yMin < result->yMax);
+}
+
+static void sw_damage_free_cells(void)
+{
+    SW_FREE(RLSW.damage.cellHashes);
+    SW_FREE(RLSW.damage.prevCellHashes);
+    SW_FREE(RLSW.damage.cellDamage);
+    SW_FREE(RLSW.damage.presentDamage);
+    SW_FREE(RLSW.damage.rects);
+    SW_FREE(RLSW.damage.openRects);
+
+    RLSW.damage.cellHashes = NULL;
+    RLSW.damage.prevCellHashes = NULL;
+    RLSW.damage.cellDamage = NULL;
+    RLSW.damage.presentDamage = NULL;
+    RLSW.damage.rects = NULL;
+    RLSW.damage.openRects = NULL;
+    RLSW.damage.cellsX = 0;
+    RLSW.damage.cellsY = 0;
+    RLSW.damage.cellCapacity = 0;
+}
+
+static void sw_damage_free(void)
+{
+    sw_damage_free_cells();
+    SW_FREE(RLSW.damage.batches);
+
+    RLSW.damage.batches = NULL;
+    RLSW.damage.batchCount = 0;
+    RLSW.damage.batchCapacity = 0;
+}
+
+// Forget the previous frame, the next flush rasterizes and presents everything
+static void sw_damage_invalidate(void)
+{
+    int cellCount = RLSW.damage.cellsX*RLSW.damage.cellsY;
+
+    for (int i = 0; i < cellCount; i++) RLSW.damage.presentDamage[i] = 1;
+
+    RLSW.damage.prevValid = false;
+}
+
+// Size the damage cells for the current framebuffer, recording is disabled if this fails
+static bool sw_damage_reserve(void)
+{
+    int cellsX = (RLSW.framebuffer.width + SW_DAMAGE_CELL_SIZE - 1)/SW_DAMAGE_CELL_SIZE;
+    int cellsY = (RLSW.framebuffer.height + SW_DAMAGE_CELL_SIZE - 1)/SW_DAMAGE_CELL_SIZE;
+    int cellCount = cellsX*cellsY;
+
+    if (cellCount > RLSW.damage.cellCapacity)
+    {
+        sw_damage_free_cells();
+
+        RLSW.damage.cellHashes = SW_MALLOC(cellCount*sizeof(uint64_t));
+        RLSW.damage.prevCellHashes = SW_MALLOC(cellCount*sizeof(uint64_t));
+        RLSW.damage.cellDamage = SW_MALLOC(cellCount);
+        RLSW.damage.presentDamage = SW_MALLOC(cellCount);
+        RLSW.damage.rects = SW_MALLOC(cellCount*sizeof(sw_tile_t));
+        RLSW.damage.openRects = SW_MALLOC(2*cellCount*sizeof(int));
+
+        if ((RLSW.damage.cellHashes == NULL) || (RLSW.damage.prevCellHashes == NULL) || (RLSW.damage.cellDamage == NULL) ||
+            (RLSW.damage.presentDamage == NULL) || (RLSW.damage.rects == NULL) || (RLSW.damage.openRects == NULL))
+        {
+            sw_damage_free_cells();
+            return false;
+        }
+
+        RLSW.damage.cellCapacity = cellCount;
+    }
+
+    RLSW.damage.cellsX = cellsX;
+    RLSW.damage.cellsY = cellsY;
+
+    for (int i = 0; i < cellCount; i++) RLSW.damage.cellHashes[i] = 0;
+
+    sw_damage_invalidate();
+
+    return true;
+}
+
+// Mix a command hash into every cell the region overlaps
+static void sw_damage_hash_region(const sw_tile_t *region, uint64_t hash)
+{
+    int cxMin = region->xMin/SW_DAMAGE_CELL_SIZE;
+    int cyMin = region->yMin/SW_DAMAGE_CELL_SIZE;
+    int cxMax = (region->xMax - 1)/SW_DAMAGE_CELL_SIZE;
+    int cyMax = (region->yMax - 1)/SW_DAMAGE_CELL_SIZE;
+
+    for (int cy = cyMin; cy <= cyMax; cy++)
+    {
+        uint64_t *row = &RLSW.damage.cellHashes[cy*RLSW.damage.cellsX];
+        for (int cx = cxMin; cx <= cxMax; cx++) row[cx] = sw_hash_mix(row[cx], hash);
+    }
+}
+
+static sw_batch_t *sw_damage_push_batch(void)
+{
+    if (!sw_raster_grow((void **)&RLSW.damage.batches, &RLSW.damage.batchCapacity, RLSW.damage.batchCount + 1, sizeof(sw_batch_t))) return NULL;
+
+    sw_batch_t *batch = &RLSW.damage.batches[RLSW.damage.batchCount++];
+
+    sw_raster_state_save(&batch->state);
+    batch->clearMask = 0;
+    batch->firstPrimitive = RLSW.raster.primitiveCount;
+    batch->primitiveCount = 0;
+
+    return batch;
+}
+
+// Open a batch for the primitives of a swBegin()/swEnd() block
+static bool sw_damage_begin(void)
+{
+    if (RLSW.damage.cellHashes == NULL) return false;
+
+    sw_batch_t *batch = sw_damage_push_batch();
+    if (batch == NULL) return false;
+
+    // Depth tested against a previous frame, the cells can't be trusted to repeat
+    if ((batch->state.stateFlags & SW_STATE_DEPTH_TEST) && !(RLSW.damage.clearedMask & SW_DEPTH_BUFFER_BIT)) RLSW.damage.depthDependent = true;
+
+    RLSW.damage.batchHash = sw_raster_state_hash(&batch->state);
+    RLSW.damage.recording = true;
+
+    return true;
+}
+
+static void sw_damage_end(void)
+{
+    if (!RLSW.damage.recording) return;
+
+    if (RLSW.damage.batches[RLSW.damage.batchCount - 1].primitiveCount == 0) RLSW.damage.batchCount--;
+    RLSW.damage.recording = false;
+}
+
+// Record a clear, scissored like the immediate one
+static bool sw_damage_record_clear(uint32_t bitmask)
+{
+    if (RLSW.damage.cellHashes == NULL) return false;
+    if ((bitmask & (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT)) == 0) return true;
+
+    sw_batch_t *batch = sw_damage_push_batch();
+    if (batch == NULL) return false;
+
+    batch->clearMask = bitmask & (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT);
+    for (int i = 0; i < 4; i++) batch->clearColor[i] = RLSW.clearColor[i];
+    batch->clearDepth = RLSW.clearDepth;
+
+    sw_tile_t region = { 0, 0, RLSW.framebuffer.width, RLSW.framebuffer.height };
+    if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
+    {
+        const sw_tile_t scissor = { RLSW.scMin[0], RLSW.scMin[1], RLSW.scMax[0] + 1, RLSW.scMax[1] + 1 };
+        sw_tile_t full = region;
+        if (!sw_tile_intersect(&full, &scissor, &region)) { RLSW.damage.batchCount--; return true; }
+    }
+
+    if ((region.xMin == 0) && (region.yMin == 0) && (region.xMax == RLSW.framebuffer.width) && (region.yMax == RLSW.framebuffer.height))
+    {
+        RLSW.damage.clearedMask |= batch->clearMask;
+    }
+
+    uint64_t hash = sw_hash_mix(0x636C656172ULL, batch->clearMask);
+    hash = sw_hash_floats(hash, batch->clearColor, 4);
+    hash = sw_hash_floats(hash, &batch->clearDepth, 1);
+    sw_damage_hash_region(&region, hash);
+
+    return true;
+}
+
+// Copy a primitive into the recording batch and hash it into the cells it overlaps
+static bool sw_damage_record(sw_primitive_type_t type, const sw_vertex_t *vertices, int vertexCount)
+{
+    float xMin = vertices[0].screen[0], xMax = xMin;
+    float yMin = vertices[0].screen[1], yMax = yMin;
+
+    for (int i = 1; i < vertexCount; i++)
+    {
+        if (vertices[i].screen[0] < xMin) xMin = vertices[i].screen[0];
+        if (vertices[i].screen[0] > xMax) xMax = vertices[i].screen[0];
+        if (vertices[i].screen[1] < yMin) yMin = vertices[i].screen[1];
+        if (vertices[i].screen[1] > yMax) yMax = vertices[i].screen[1];
+    }
+
+    float pad = 1.0f;
+    if (type == SW_PRIMITIVE_LINE) pad += RLSW.lineWidth;
+    else if (type == SW_PRIMITIVE_POINT) pad += RLSW.pointRadius;
+
+    sw_tile_t bounds = {
+        sw_clampi((int)floorf(xMin - pad), 0, RLSW.framebuffer.width),
+        sw_clampi((int)floorf(yMin - pad), 0, RLSW.framebuffer.height),
+        sw_clampi((int)ceilf(xMax + pad) + 1, 0, RLSW.framebuffer.width),
+        sw_clampi((int)ceilf(yMax + pad) + 1, 0, RLSW.framebuffer.height)
+    };
+    if ((bounds.xMin >= bounds.xMax) || (bounds.yMin >= bounds.yMax)) return true;  // Nothing visible
+
+    if (!sw_raster_grow((void **)&RLSW.raster.vertices, &RLSW.raster.vertexCapacity, RLSW.raster.vertexCount + vertexCount, sizeof(sw_vertex_t))) return false;
+    if (!sw_raster_grow((void **)&RLSW.raster.primitives, &RLSW.raster.primitiveCapacity, RLSW.raster.primitiveCount + 1, sizeof(sw_primitive_t))) return false;
+
+    RLSW.raster.primitives[RLSW.raster.primitiveCount++] = (sw_primitive_t) { type, RLSW.raster.vertexCount, vertexCount, bounds };
+    RLSW.damage.batches[RLSW.damage.batchCount - 1].primitiveCount++;
+
+    uint64_t hash = sw_hash_mix(RLSW.damage.batchHash, ((uint64_t)type << 32) | (uint32_t)vertexCount);
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        const sw_vertex_t *v = &vertices[i];
+
+        hash = sw_hash_floats(hash, v->screen, 2);
+        hash = sw_hash_floats(hash, &v->homogeneous[2], 2);
+        hash = sw_hash_floats(hash, v->texcoord, 2);
+        hash = sw_hash_floats(hash, v->color, 4);
+
+        RLSW.raster.vertices[RLSW.raster.vertexCount++] = *v;
+    }
+
+    sw_damage_hash_region(&bounds, hash);
+
+    return true;
+}
+
+// Merge the damaged cells into rectangles: runs along each cell row, stacked onto the
+// rectangle above when it spans the same columns
+static int sw_damage_merge_cells(const uint8_t *cells, sw_tile_t *rects)
+{
+    const int cellsX = RLSW.damage.cellsX;
+
+    int *open = RLSW.damage.openRects;              // Rectangles reaching the previous row, by x
+    int *next = RLSW.damage.openRects + cellsX;     // Rectangles reaching the current row
+    int openCount = 0;
+    int count = 0;
+
+    for (int cy = 0; cy < RLSW.damage.cellsY; cy++)
+    {
+        const uint8_t *row = &cells[cy*cellsX];
+        int yMin = cy*SW_DAMAGE_CELL_SIZE;
+        int yMax = sw_clampi(yMin + SW_DAMAGE_CELL_SIZE, 0, RLSW.framebuffer.height);
+        int nextCount = 0;
+        int o = 0;
+
+        for (int cx = 0; cx < cellsX; cx++)
+        {
+            if (!row[cx]) continue;
+
+            int runStart = cx;
+            while ((cx + 1 < cellsX) && row[cx + 1]) cx++;
+
+            int xMin = runStart*SW_DAMAGE_CELL_SIZE;
+            int xMax = sw_clampi((cx + 1)*SW_DAMAGE_CELL_SIZE, 0, RLSW.framebuffer.width);
+
+            while ((o < openCount) && (rects[open[o]].xMin < xMin)) o++;
+
+            int index = 0;
+            if ((o < openCount) && (rects[open[o]].xMin == xMin) && (rects[open[o]].xMax == xMax))
+            {
+                index = open[o++];
+                rects[index].yMax = yMax;
+            }
+            else
+            {
+                index = count++;
+                rects[index] = (sw_tile_t) { xMin, yMin, xMax, yMax };
+            }
+
+            next[nextCount++] = index;
+        }
+
+        int *swap = open;
+        open = next;
+        next = swap;
+        openCount = nextCount;
+    }
+
+    return count;
+}
+
+// Replay a recorded clear inside the damaged rectangles
+static void sw_damage_replay_clear(const sw_batch_t *batch)
+{
+    sw_tile_t region = { 0, 0, RLSW.framebuffer.width, RLSW.framebuffer.height };
+    if (batch->state.stateFlags & SW_STATE_SCISSOR_TEST)
+    {
+        region.xMin = batch->state.scMin[0];
+        region.yMin = batch->state.scMin[1];
+        region.xMax = batch->state.scMax[0] + 1;
+        region.yMax = batch->state.scMax[1] + 1;
+    }
+
+    // The fill functions apply the scissor themselves otherwise
+    RLSW.stateFlags = 0;
+
+    for (int r = 0; r < RLSW.damage.rectCount; r++)
+    {
+        sw_tile_t area;
+        if (!sw_tile_intersect(&region, &RLSW.damage.rects[r], &area)) continue;
+
+        int width = area.xMax - area.xMin;
+
+        for (int y = area.yMin; y < area.yMax; y++)
+        {
+            uint32_t offset = y*RLSW.framebuffer.width + area.xMin;
+
+            if (batch->clearMask & SW_COLOR_BUFFER_BIT) sw_framebuffer_fill_color(sw_framebuffer_get_color_addr(RLSW.framebuffer.color, offset), width, batch->clearColor);
+            if (batch->clearMask & SW_DEPTH_BUFFER_BIT) sw_framebuffer_fill_depth(sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, offset), width, batch->clearDepth);
+        }
+    }
+}
+
+// Split the damaged rectangles into tiles along the SW_RASTER_TILE_HEIGHT bands
+static bool sw_damage_bins_reserve(void)
 {
-    if (!sw_line_clip_and_project(&vertices[0], &vertices[1])) return;
+    int tileCount = 0;
 
-    if (RLSW.lineWidth >= 2.0f)
+    for (int r = 0; r < RLSW.damage.rectCount; r++)
     {
-        if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_line_thick_raster_DEPTH_BLEND(&vertices[0], &vertices[1]);
-        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_line_thick_raster_BLEND(&vertices[0], &vertices[1]);
-        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_line_thick_raster_DEPTH(&vertices[0], &vertices[1]);
-        else sw_line_thick_raster(&vertices[0], &vertices[1]);
+        const sw_tile_t *rect = &RLSW.damage.rects[r];
+        tileCount += (rect->yMax - 1)/SW_RASTER_TILE_HEIGHT - rect->yMin/SW_RASTER_TILE_HEIGHT + 1;
     }
-    else
+
+    if (!sw_raster_bins_grow(tileCount)) return false;
+
+    int t = 0;
+    for (int r = 0; r < RLSW.damage.rectCount; r++)
     {
-        if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_line_raster_DEPTH_BLEND(&vertices[0], &vertices[1]);
-        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_line_raster_BLEND(&vertices[0], &vertices[1]);
-        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_line_raster_DEPTH(&vertices[0], &vertices[1]);
-        else sw_line_raster(&vertices[0], &vertices[1]);
+        const sw_tile_t *rect = &RLSW.damage.rects[r];
+
+        for (int y = rect->yMin; y < rect->yMax; )
+        {
+            int yNext = (y/SW_RASTER_TILE_HEIGHT + 1)*SW_RASTER_TILE_HEIGHT;
+            if (yNext > rect->yMax) yNext = rect->yMax;
+
+            RLSW.raster.bins[t++].tile = (sw_tile_t) { rect->xMin, y, rect->xMax, yNext };
+            y = yNext;
+        }
     }
-}
 
-// Point rendering logic
+    RLSW.raster.tileCount = tileCount;
 
-static inline bool sw_point_clip_and_project(sw_vertex_t *v)
+    return true;
+}
+
+// Replay the primitives of a recorded batch inside the damaged rectangles
+static void sw_damage_replay_batch(const sw_batch_t *batch, bool parallel)
 {
-    if (v->homogeneous[3] != 1.0f)
+    sw_raster_state_load(&batch->state);
+
+    const int first = batch->firstPrimitive;
+    const int last = batch->firstPrimitive + batch->primitiveCount;
+
+    if (parallel)
     {
-        for (int_fast8_t i = 0; i < 3; i++)
+        int64_t area = 0;
+
+        for (int i = first; i < last; i++)
         {
-            if ((v->homogeneous[i] < -v->homogeneous[3]) || (v->homogeneous[i] > v->homogeneous[3])) return false;
+            for (int r = 0; r < RLSW.damage.rectCount; r++)
+            {
+                sw_tile_t overlap;
+                if (sw_tile_intersect(&RLSW.raster.primitives[i].bounds, &RLSW.damage.rects[r], &overlap))
+                {
+                    area += (int64_t)(overlap.xMax - overlap.xMin)*(overlap.yMax - overlap.yMin);
+                }
+            }
         }
 
-        v->homogeneous[3] = 1.0f/v->homogeneous[3];
-        v->homogeneous[0] *= v->homogeneous[3];
-        v->homogeneous[1] *= v->homogeneous[3];
-        v->homogeneous[2] *= v->homogeneous[3];
-    }
+        if (area >= SW_RASTER_PARALLEL_MIN_AREA)
+        {
+            bool binned = true;
 
-    sw_project_ndc_to_screen(v->screen, v->homogeneous);
+            for (int t = 0; t < RLSW.raster.tileCount; t++)
+            {
+                sw_tile_bin_t *bin = &RLSW.raster.bins[t];
+                bin->count = 0;
 
-    const int *min = NULL, *max = NULL;
+                for (int i = first; (i < last) && binned; i++)
+                {
+                    sw_tile_t overlap;
+                    if (!sw_tile_intersect(&RLSW.raster.primitives[i].bounds, &bin->tile, &overlap)) continue;
 
-    if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
+                    if (!sw_raster_grow((void **)&bin->primitives, &bin->capacity, bin->count + 1, sizeof(int))) binned = false;
+                    else bin->primitives[bin->count++] = i;
+                }
+            }
+
+            if (binned)
+            {
+                sw_raster_run_parallel();
+                return;
+            }
+        }
+    }
+
+    // Small batch, waking the workers would cost more than it saves
+    for (int r = 0; r < RLSW.damage.rectCount; r++)
     {
-        min = RLSW.scMin;
-        max = RLSW.scMax;
+        const sw_tile_t *rect = &RLSW.damage.rects[r];
+
+        for (int i = first; i < last; i++)
+        {
+            const sw_primitive_t *primitive = &RLSW.raster.primitives[i];
+            sw_tile_t overlap;
+
+            if (sw_tile_intersect(&primitive->bounds, rect, &overlap))
+            {
+                sw_primitive_rasterize(primitive->type, &RLSW.raster.vertices[primitive->firstVertex], primitive->vertexCount, rect);
+            }
+        }
     }
-    else
+}
+
+// Rasterize the recorded commands within the cells that differ from the previous frame
+static void sw_damage_flush(void)
+{
+    RLSW.damage.recording = false;
+
+    if (RLSW.damage.batchCount == 0) return;
+
+    // Cells can only be kept when the frame draws them from scratch, as the previous one did
+    bool reuse = RLSW.damage.prevValid && (RLSW.damage.clearedMask & SW_COLOR_BUFFER_BIT) && !RLSW.damage.depthDependent;
+    int cellCount = RLSW.damage.cellsX*RLSW.damage.cellsY;
+
+    for (int i = 0; i < cellCount; i++)
     {
-        min = RLSW.vpMin;
-        max = RLSW.vpMax;
+        uint8_t damaged = !reuse || (RLSW.damage.cellHashes[i] != RLSW.damage.prevCellHashes[i]);
+
+        RLSW.damage.cellDamage[i] = damaged;
+        RLSW.damage.presentDamage[i] |= damaged;
+        RLSW.damage.prevCellHashes[i] = RLSW.damage.cellHashes[i];
+        RLSW.damage.cellHashes[i] = 0;
     }
 
-    bool insideX = (v->screen[0] - RLSW.pointRadius < max[0]) && (v->screen[0] + RLSW.pointRadius > min[0]);
-    bool insideY = (v->screen[1] - RLSW.pointRadius < max[1]) && (v->screen[1] + RLSW.pointRadius > min[1]);
+    RLSW.damage.prevValid = true;
+    RLSW.damage.clearedMask = 0;
+    RLSW.damage.depthDependent = false;
 
-    return (insideX && insideY);
-}
+    RLSW.damage.rectCount = sw_damage_merge_cells(RLSW.damage.cellDamage, RLSW.damage.rects);
 
-#define DEFINE_POINT_RASTER(FUNC_NAME, ENABLE_DEPTH_TEST, ENABLE_COLOR_BLEND, CHECK_BOUNDS) \
-static inline void FUNC_NAME(int x, int y, float z, const float color[4])   \
-{                                                                           \
-    if (CHECK_BOUNDS == 1)                                                  \
-    {                                                                       \
-        if (x < RLSW.vpMin[0] || x >= RLSW.vpMax[0]) return;                \
-        if (y < RLSW.vpMin[1] || y >= RLSW.vpMax[1]) return;                \
-    }                                                                       \
-    else if (CHECK_BOUNDS == SW_SCISSOR_TEST)                               \
-    {                                                                       \
-        if (x < RLSW.scMin[0] || x >= RLSW.scMax[0]) return;                \
-        if (y < RLSW.scMin[1] || y >= RLSW.scMax[1]) return;                \
-    }                                                                       \
-                                                                            \
-    int offset = y*RLSW.framebuffer.width + x;                              \
-                                                                            \
-    void *dptr = sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, offset); \
-                                                                            \
-    if (ENABLE_DEPTH_TEST)                                                  \
-    {                                                                       \
-        float depth = sw_framebuffer_read_depth(dptr);                      \
-        if (z > depth) return;                                              \
-    }                                                                       \
-                                                                            \
-    sw_framebuffer_write_depth(dptr, z);                                    \
-                                                                            \
-    void *cptr = sw_framebuffer_get_color_addr(RLSW.framebuffer.color, offset); \
-                                                                            \
-    if (ENABLE_COLOR_BLEND)                                                 \
-    {                                                                       \
-        float dstColor[4];                                                  \
-        sw_framebuffer_read_color(dstColor, cptr);                          \
-                                                                            \
-        sw_blend_colors(dstColor, color);                                   \
-        sw_framebuffer_write_color(cptr, dstColor);                         \
-    }                                                                       \
-    else sw_framebuffer_write_color(cptr, color);                           \
-}
+    if (RLSW.damage.rectCount > 0)
+    {
+        sw_raster_state_t current;
+        sw_raster_state_save(&current);
 
-#define DEFINE_POINT_THICK_RASTER(FUNC_NAME, RASTER_FUNC)                   \
-static inline void FUNC_NAME(sw_vertex_t *v)                                \
-{                                                                           \
-    int cx = v->screen[0];                                                  \
-    int cy = v->screen[1];                                                  \
-    float cz = v->homogeneous[2];                                           \
-    int radius = RLSW.pointRadius;                                          \
-    const float *color = v->color;                                          \
-                                                                            \
-    int x = 0;                                                              \
-    int y = radius;                                                         \
-    int d = 3 - 2*radius;                                                   \
-                                                                            \
-    while (x <= y)                                                          \
-    {                                                                       \
-        for (int i = -x; i <= x; i++)                                       \
-        {                                                                   \
-            RASTER_FUNC(cx + i, cy + y, cz, color);                         \
-            RASTER_FUNC(cx + i, cy - y, cz, color);                         \
-        }                                                                   \
-        for (int i = -y; i <= y; i++)                                       \
-        {                                                                   \
-            RASTER_FUNC(cx + i, cy + x, cz, color);                         \
-            RASTER_FUNC(cx + i, cy - x, cz, color);                         \
-        }                                                                   \
-        if (d > 0)                                                          \
-        {                                                                   \
-            y--;                                                            \
-            d = d + 4*(x - y) + 10;                                         \
-        }                                                                   \
-        else d = d + 4*x + 6;                                               \
-        x++;                                                                \
-    }                                                                       \
-}
+        bool parallel = (RLSW.raster.threadCount > 1) && sw_damage_bins_reserve();
 
-DEFINE_POINT_RASTER(sw_point_raster, 0, 0, 0)
-DEFINE_POINT_RASTER(sw_point_raster_DEPTH, 1, 0, 0)
-DEFINE_POINT_RASTER(sw_point_raster_BLEND, 0, 1, 0)
-DEFINE_POINT_RASTER(sw_point_raster_DEPTH_BLEND, 1, 1, 0)
+        for (int b = 0; b < RLSW.damage.batchCount; b++)
+        {
+            const sw_batch_t *batch = &RLSW.damage.batches[b];
 
-DEFINE_POINT_RASTER(sw_point_raster_CHECK, 0, 0, 1)
-DEFINE_POINT_RASTER(sw_point_raster_DEPTH_CHECK, 1, 0, 1)
-DEFINE_POINT_RASTER(sw_point_raster_BLEND_CHECK, 0, 1, 1)
-DEFINE_POINT_RASTER(sw_point_raster_DEPTH_BLEND_CHECK, 1, 1, 1)
+            if (batch->clearMask) sw_damage_replay_clear(batch);
+            else sw_damage_replay_batch(batch, parallel);
+        }
 
-DEFINE_POINT_RASTER(sw_point_raster_CHECK_SCISSOR, 0, 0, SW_SCISSOR_TEST)
-DEFINE_POINT_RASTER(sw_point_raster_DEPTH_CHECK_SCISSOR, 1, 0, SW_SCISSOR_TEST)
-DEFINE_POINT_RASTER(sw_point_raster_BLEND_CHECK_SCISSOR, 0, 1, SW_SCISSOR_TEST)
-DEFINE_POINT_RASTER(sw_point_raster_DEPTH_BLEND_CHECK_SCISSOR, 1, 1, SW_SCISSOR_TEST)
+        for (int t = 0; t < RLSW.raster.tileCount; t++) RLSW.raster.bins[t].count = 0;
 
-DEFINE_POINT_THICK_RASTER(sw_point_thick_raster, sw_point_raster_CHECK)
-DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_DEPTH, sw_point_raster_DEPTH_CHECK)
-DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_BLEND, sw_point_raster_BLEND_CHECK)
-DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_DEPTH_BLEND, sw_point_raster_DEPTH_BLEND_CHECK)
+        sw_raster_state_load(&current);
+    }
 
-DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_SCISSOR, sw_point_raster_CHECK_SCISSOR)
-DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_DEPTH_SCISSOR, sw_point_raster_DEPTH_CHECK_SCISSOR)
-DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_BLEND_SCISSOR, sw_point_raster_BLEND_CHECK_SCISSOR)
-DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_DEPTH_BLEND_SCISSOR, sw_point_raster_DEPTH_BLEND_CHECK_SCISSOR)
+    RLSW.damage.batchCount = 0;
+    RLSW.raster.vertexCount = 0;
+    RLSW.raster.primitiveCount = 0;
+}
 
-static inline void sw_point_render(sw_vertex_t *v)
+// Rasterize the recorded commands, then drop the cell history after one that could not be recorded
+static void sw_damage_fail(void)
 {
-    if (!sw_point_clip_and_project(v)) return;
+    sw_damage_flush();
+    sw_damage_invalidate();
+}
 
-    if (RLSW.pointRadius >= 1.0f)
+// Recorded batches may sample the texture as it was, rasterize them before it changes
+static void sw_damage_touch_texture(sw_texture_t *texture)
+{
+    if (RLSW.damage.batchCount > 0) sw_damage_flush();
+
+    texture->version = ++RLSW.damage.textureVersion;
+}
+
+#endif // SW_DAMAGE_DEFERRED
+
+#endif // SW_RASTER_THREADS != 1
+
+static inline void sw_primitive_submit(sw_primitive_type_t type, const sw_vertex_t *vertices, int vertexCount)
+{
+#if defined(SW_DAMAGE_DEFERRED)
+    if (RLSW.damage.recording)
     {
-        if (SW_STATE_CHECK(SW_STATE_SCISSOR_TEST))
-        {
-            if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_point_thick_raster_DEPTH_BLEND_SCISSOR(v);
-            else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_point_thick_raster_BLEND_SCISSOR(v);
-            else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_point_thick_raster_DEPTH_SCISSOR(v);
-            else sw_point_thick_raster_SCISSOR(v);
-        }
-        else
-        {
-            if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_point_thick_raster_DEPTH_BLEND(v);
-            else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_point_thick_raster_BLEND(v);
-            else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_point_thick_raster_DEPTH(v);
-            else sw_point_thick_raster(v);
-        }
+        if (sw_damage_record(type, vertices, vertexCount)) return;
+
+        // Out of memory, the rest of the block is rasterized directly
+        sw_damage_fail();
     }
-    else
+#endif
+
+#if (SW_RASTER_THREADS != 1)
+    if (RLSW.raster.binning)
     {
-        if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_point_raster_DEPTH_BLEND(v->screen[0], v->screen[1], v->homogeneous[2], v->color);
-        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_point_raster_BLEND(v->screen[0], v->screen[1], v->homogeneous[2], v->color);
-        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_point_raster_DEPTH(v->screen[0], v->screen[1], v->homogeneous[2], v->color);
-        else sw_point_raster(v->screen[0], v->screen[1], v->homogeneous[2], v->color);
+        if (sw_primitive_bin(type, vertices, vertexCount)) return;
+
+        // Out of memory, keep the submission order by draining the batch first
+        sw_raster_flush();
     }
+#endif
+
+    const sw_tile_t tile = { 0, 0, RLSW.framebuffer.width, RLSW.framebuffer.height };
+    sw_primitive_rasterize(type, vertices, vertexCount, &tile);
 }
 
 // Polygon modes mendering logic
@@ -3882,6 +5649,18 @@ bool swInit(int w, int h)
 
     RLSW.loadedTextureCount = 1;
 
+#if (SW_RASTER_THREADS != 1)
+    int threadCount = (SW_RASTER_THREADS > 0)? SW_RASTER_THREADS : sw_get_cpu_count();
+    if (threadCount > SW_RASTER_MAX_THREADS) threadCount = SW_RASTER_MAX_THREADS;
+
+    RLSW.raster.threadCount = 1;
+    if ((threadCount > 1) && !sw_raster_threads_start(threadCount)) { swClose(); return false; }
+#endif
+
+#if defined(SW_DAMAGE_DEFERRED)
+    if (!sw_damage_reserve()) { swClose(); return false; }
+#endif
+
     return true;
 }
 
@@ -3898,12 +5677,53 @@ void swClose(void)
     SW_FREE(RLSW.loadedTextures);
     SW_FREE(RLSW.freeTextureIds);
 
+#if (SW_RASTER_THREADS != 1)
+    if (RLSW.raster.threadCount > 1) sw_raster_threads_stop();
+    sw_raster_free();
+#endif
+
+#if defined(SW_DAMAGE_DEFERRED)
+    sw_damage_free();
+#endif
+
     RLSW = (sw_context_t) { 0 };
 }
 
 bool swResizeFramebuffer(int w, int h)
 {
+#if defined(SW_DAMAGE_DEFERRED)
+    sw_damage_flush();
+
+    if (!sw_framebuffer_resize(w, h)) return false;
+
+    // Without cells nothing gets recorded, frames are rasterized directly
+    sw_damage_reserve();
+
+    return true;
+#else
     return sw_framebuffer_resize(w, h);
+#endif
+}
+
+static void sw_framebuffer_copy(int x, int y, int w, int h, sw_pixelformat_t format, int pitch, void *pixels)
+{
+    switch (format)
+    {
+        case SW_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: sw_framebuffer_copy_to_GRAYSCALE(x, y, w, h, pitch, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: sw_framebuffer_copy_to_GRAYALPHA(x, y, w, h, pitch, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R5G6B5: sw_framebuffer_copy_to_R5G6B5(x, y, w, h, pitch, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8: sw_framebuffer_copy_to_R8G8B8(x, y, w, h, pitch, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: sw_framebuffer_copy_to_R5G5B5A1(x, y, w, h, pitch, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: sw_framebuffer_copy_to_R4G4B4A4(x, y, w, h, pitch, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: sw_framebuffer_copy_to_R8G8B8A8(x, y, w, h, pitch, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R32: sw_framebuffer_copy_to_R32(x, y, w, h, pitch, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R32G32B32: sw_framebuffer_copy_to_R32G32B32(x, y, w, h, pitch, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: sw_framebuffer_copy_to_R32G32B32A32(x, y, w, h, pitch, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R16: sw_framebuffer_copy_to_R16(x, y, w, h, pitch, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16: sw_framebuffer_copy_to_R16G16B16(x, y, w, h, pitch, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: sw_framebuffer_copy_to_R16G16B16A16(x, y, w, h, pitch, pixels); break;
+        default: RLSW.errCode = SW_INVALID_ENUM; break;
+    }
 }
 
 void swCopyFramebuffer(int x, int y, int w, int h, SWformat format, SWtype type, void *pixels)
@@ -3922,29 +5742,77 @@ void swCopyFramebuffer(int x, int y, int w, int h, SWformat format, SWtype type,
         return;
     }
 
-    if (w > RLSW.framebuffer.width) w = RLSW.framebuffer.width;
-    if (h > RLSW.framebuffer.height) h = RLSW.framebuffer.height;
+#if defined(SW_DAMAGE_DEFERRED)
+    sw_damage_flush();
+#endif
+
+    x = sw_clampi(x, 0, RLSW.framebuffer.width);
+    y = sw_clampi(y, 0, RLSW.framebuffer.height);
 
-    x = sw_clampi(x, 0, w);
-    y = sw_clampi(y, 0, h);
+    if (w > RLSW.framebuffer.width - x) w = RLSW.framebuffer.width - x;
+    if (h > RLSW.framebuffer.height - y) h = RLSW.framebuffer.height - y;
 
-    switch (pFormat)
+    sw_framebuffer_copy(x, y, w, h, pFormat, w*sw_get_pixel_bytes(pFormat), pixels);
+}
+
+int swCopyFramebufferDamage(SWformat format, SWtype type, int pitch, void *pixels, int *rects, int maxRects)
+{
+    sw_pixelformat_t pFormat = sw_get_pixel_format(format, type);
+    int bytes = sw_get_pixel_bytes(pFormat);
+
+    if ((pixels == NULL) || (rects == NULL) || (maxRects <= 0))
     {
-        case SW_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: sw_framebuffer_copy_to_GRAYALPHA(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: sw_framebuffer_copy_to_GRAYALPHA(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R5G6B5: sw_framebuffer_copy_to_R5G6B5(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8: sw_framebuffer_copy_to_R8G8B8(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: sw_framebuffer_copy_to_R5G5B5A1(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: sw_framebuffer_copy_to_R4G4B4A4(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: sw_framebuffer_copy_to_R8G8B8A8(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R32: sw_framebuffer_copy_to_R32(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R32G32B32: sw_framebuffer_copy_to_R32G32B32(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: sw_framebuffer_copy_to_R32G32B32A32(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R16: sw_framebuffer_copy_to_R16(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16: sw_framebuffer_copy_to_R16G16B16(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: sw_framebuffer_copy_to_R16G16B16A16(x, y, w, h, pixels); break;
-        default: RLSW.errCode = SW_INVALID_ENUM; break;
+        RLSW.errCode = SW_INVALID_VALUE;
+        return 0;
+    }
+
+    const sw_tile_t full = { 0, 0, RLSW.framebuffer.width, RLSW.framebuffer.height };
+    const sw_tile_t *damage = &full;
+    int count = 1;
+
+#if defined(SW_DAMAGE_DEFERRED)
+    sw_damage_flush();
+
+    if (RLSW.damage.presentDamage != NULL)
+    {
+        count = sw_damage_merge_cells(RLSW.damage.presentDamage, RLSW.damage.rects);
+        damage = RLSW.damage.rects;
+
+        int cellCount = RLSW.damage.cellsX*RLSW.damage.cellsY;
+        for (int i = 0; i < cellCount; i++) RLSW.damage.presentDamage[i] = 0;
+
+        // Too many to report, one rectangle bounding them all
+        if (count > maxRects)
+        {
+            sw_tile_t bounds = damage[0];
+            for (int r = 1; r < count; r++)
+            {
+                if (damage[r].xMin < bounds.xMin) bounds.xMin = damage[r].xMin;
+                if (damage[r].xMax > bounds.xMax) bounds.xMax = damage[r].xMax;
+                if (damage[r].yMax > bounds.yMax) bounds.yMax = damage[r].yMax;
+            }
+
+            RLSW.damage.rects[0] = bounds;
+            count = 1;
+        }
+    }
+#endif
+
+    for (int r = 0; r < count; r++)
+    {
+        const sw_tile_t *rect = &damage[r];
+        int w = rect->xMax - rect->xMin;
+        int h = rect->yMax - rect->yMin;
+
+        sw_framebuffer_copy(rect->xMin, rect->yMin, w, h, pFormat, pitch, (uint8_t *)pixels + (size_t)rect->yMin*pitch + rect->xMin*bytes);
+
+        rects[4*r + 0] = rect->xMin;
+        rects[4*r + 1] = rect->yMin;
+        rects[4*r + 2] = w;
+        rects[4*r + 3] = h;
     }
+
+    return count;
 }
 
 void swBlitFramebuffer(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySrc, int wSrc, int hSrc, SWformat format, SWtype type, void *pixels)
@@ -3963,6 +5831,10 @@ void swBlitFramebuffer(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySr
         return;
     }
 
+#if defined(SW_DAMAGE_DEFERRED)
+    sw_damage_flush();
+#endif
+
     if (wSrc > RLSW.framebuffer.width) wSrc = RLSW.framebuffer.width;
     if (hSrc > RLSW.framebuffer.height) hSrc = RLSW.framebuffer.height;
 
@@ -3990,12 +5862,23 @@ void swBlitFramebuffer(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySr
 
 void *swGetColorBuffer(int *w, int *h)
 {
+#if defined(SW_DAMAGE_DEFERRED)
+    sw_damage_flush();
+#endif
+
     if (w) *w = RLSW.framebuffer.width;
     if (h) *h = RLSW.framebuffer.height;
 
     return RLSW.framebuffer.color;
 }
 
+void swFlush(void)
+{
+#if defined(SW_DAMAGE_DEFERRED)
+    sw_damage_flush();
+#endif
+}
+
 void swEnable(SWstate state)
 {
     switch (state)
@@ -4158,6 +6041,11 @@ void swClearColor(float r, float g, float b, float a)
 
 void swClear(uint32_t bitmask)
 {
+#if defined(SW_DAMAGE_DEFERRED)
+    if (sw_damage_record_clear(bitmask)) return;
+    sw_damage_fail();
+#endif
+
     int size = RLSW.framebuffer.width*RLSW.framebuffer.height;
 
     if ((bitmask & (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT)) == (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT))
@@ -4549,10 +6437,30 @@ void swBegin(SWdraw mode)
     // Initialize required values
     RLSW.vertexCounter = 0;
     RLSW.drawMode = mode;
+
+#if defined(SW_DAMAGE_DEFERRED)
+    // Primitives are recorded and rasterized with the rest of the frame
+    if (sw_damage_begin()) return;
+    sw_damage_fail();
+#endif
+
+#if (SW_RASTER_THREADS != 1)
+    // Primitives are binned by tile and rasterized on swEnd()
+    RLSW.raster.binning = (RLSW.raster.threadCount > 1) && sw_raster_bins_reserve();
+#endif
 }
 
 void swEnd(void)
 {
+#if defined(SW_DAMAGE_DEFERRED)
+    sw_damage_end();
+#endif
+
+#if (SW_RASTER_THREADS != 1)
+    if (RLSW.raster.binning) sw_raster_flush();
+    RLSW.raster.binning = false;
+#endif
+
     RLSW.drawMode = 0;
 }
 
@@ -4801,6 +6709,10 @@ void swDeleteTextures(int count, uint32_t *textures)
             continue;
         }
 
+#if defined(SW_DAMAGE_DEFERRED)
+        sw_damage_touch_texture(&RLSW.loadedTextures[textures[i]]);
+#endif
+
         if (RLSW.loadedTextures[textures[i]].copy)
         {
             SW_FREE(RLSW.loadedTextures[textures[i]].pixels.ptr);
@@ -4831,6 +6743,10 @@ void swTexImage2D(int width, int height, SWformat format, SWtype type, bool copy
 
     sw_texture_t *texture = &RLSW.loadedTextures[id];
 
+#if defined(SW_DAMAGE_DEFERRED)
+    sw_damage_touch_texture(texture);
+#endif
+
     if (copy)
     {
         int bytes = sw_get_pixel_bytes(pixelFormat);
@@ -4872,6 +6788,10 @@ void swTexParameteri(int param, int value)
 
     sw_texture_t *texture = &RLSW.loadedTextures[id];
 
+#if defined(SW_DAMAGE_DEFERRED)
+    sw_damage_touch_texture(texture);
+#endif
+
     switch (param)
     {
         case SW_TEXTURE_MIN_FILTER:
@@ -94,6 +94,10 @@
 
 #define SCANCODE_MAPPED_NUM     232
 
+#ifndef MAX_PRESENT_RECTS
+    #define MAX_PRESENT_RECTS       64      // Changed screen rectangles updated per frame (software renderer), more are merged into one
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -105,6 +109,9 @@ typedef struct {
     SDL_JoystickID gamepadId[MAX_GAMEPADS]; // Joystick instance ids, they do not start from 0
     SDL_Cursor *cursor;
     bool cursorRelative;
+
+    SDL_Surface *surface;               // Window surface the software framebuffer was last presented to
+    bool surfaceInvalid;                // Window surface needs a full copy and update (resized, exposed)
 } PlatformData;
 
 //----------------------------------------------------------------------------------
@@ -1234,8 +1241,29 @@ void SwapScreenBuffer(void)
 #if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
     // NOTE: We use a preprocessor condition here because `rlCopyFramebuffer` is only declared for software rendering
     SDL_Surface *surface = SDL_GetWindowSurface(platform.window);
-    rlCopyFramebuffer(0, 0, CORE.Window.render.width, CORE.Window.render.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, surface->pixels);
-    SDL_UpdateWindowSurface(platform.window);
+
+    if ((surface != platform.surface) || platform.surfaceInvalid)
+    {
+        rlCopyFramebuffer(0, 0, CORE.Window.render.width, CORE.Window.render.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, surface->pixels);
+        SDL_UpdateWindowSurface(platform.window);
+
+        platform.surface = surface;
+        platform.surfaceInvalid = false;
+    }
+    else
+    {
+        // Only the regions that changed since the previous frame are copied and updated
+        int rects[4*MAX_PRESENT_RECTS] = { 0 };
+        int count = rlCopyFramebufferDamage(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, surface->pitch, surface->pixels, rects, MAX_PRESENT_RECTS);
+
+        if (count > 0)
+        {
+            SDL_Rect updateRects[MAX_PRESENT_RECTS] = { 0 };
+            for (int i = 0; i < count; i++) updateRects[i] = (SDL_Rect){ rects[4*i], rects[4*i + 1], rects[4*i + 2], rects[4*i + 3] };
+
+            SDL_UpdateWindowSurfaceRects(platform.window, updateRects, count);
+        }
+    }
 #else
     SDL_GL_SwapWindow(platform.window);
 #endif
@@ -1462,6 +1490,7 @@ void PollInputEvents(void)
                         CORE.Window.currentFbo.width = width;
                         CORE.Window.currentFbo.height = height;
                         CORE.Window.resizedLastFrame = true;
+                        platform.surfaceInvalid = true;
 
                         #ifndef USING_VERSION_SDL3
                         // Manually detect if the window was maximized (due to SDL2 restore being unreliable on some platforms) to remove the FLAG_WINDOW_MAXIMIZED accordingly
@@ -1480,6 +1509,11 @@ void PollInputEvents(void)
                         #endif
                     } break;
 
+                    case SDL_WINDOWEVENT_EXPOSED:
+                    {
+                        platform.surfaceInvalid = true;
+                    } break;
+
                     case SDL_WINDOWEVENT_ENTER:
                     {
                         CORE.Input.Mouse.cursorOnScreen = true;
@@ -152,6 +152,8 @@ static PFNWGLSWAPINTERVALEXTPROC wglSwapIntervalEXT = NULL;
 
 #define CLASS_NAME              L"RaylibWindow"
 
+#define MAX_PRESENT_RECTS       64      // Changed screen rectangles invalidated per frame (software renderer)
+
 #define FLAG_MASK_OPTIONAL      (FLAG_VSYNC_HINT)
 #define FLAG_MASK_REQUIRED      ~(FLAG_MASK_OPTIONAL)
 
@@ -1156,12 +1158,21 @@ void SwapScreenBuffer(void)
     if (!platform.hdc) abort();
 
 #if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
-    // Update framebuffer
-    rlCopyFramebuffer(0, 0, CORE.Window.render.width, CORE.Window.render.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, platform.pixels);
+    // Update the framebuffer regions that changed since the previous frame
+    int rects[4*MAX_PRESENT_RECTS] = { 0 };
+    int count = rlCopyFramebufferDamage(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, platform.appScreenWidth*4, platform.pixels, rects, MAX_PRESENT_RECTS);
+
+    // Force redraw, WM_PAINT blit is clipped to the invalidated rectangles
+    if (count > 0)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            RECT rect = { rects[4*i], rects[4*i + 1], rects[4*i] + rects[4*i + 2], rects[4*i + 1] + rects[4*i + 3] };
+            InvalidateRect(platform.hwnd, &rect, FALSE);
+        }
 
-    // Force redraw
-    InvalidateRect(platform.hwnd, NULL, FALSE);
-    UpdateWindow(platform.hwnd);
+        UpdateWindow(platform.hwnd);
+    }
 #else
     if (!SwapBuffers(platform.hdc)) TRACELOG(LOG_ERROR, "%s failed, error=%lu", "SwapBuffers", GetLastError());
     if (!ValidateRect(platform.hwnd, NULL)) TRACELOG(LOG_ERROR, "%s failed, error=%lu", "ValidateRect", GetLastError());
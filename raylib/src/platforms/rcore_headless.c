@@ -0,0 +1,923 @@
+/**********************************************************************************************
+*
+*   rcore_headless - Functions to manage window, graphics device and inputs without a display
+*
+*   PLATFORM: HEADLESS
+*       - Any OS with a C99 compiler: no window, no display server, no GPU required
+*       - Intended for automated tests (CI), render farms and offline video generation
+*
+*   LIMITATIONS:
+*       - Software rendering only (GRAPHICS_API_OPENGL_11_SOFTWARE, rlsw), frames never reach a screen
+*       - Input only comes from the programmatic queue (PushHeadless*()) or an automation events list
+*       - Mouse input is not translated into gestures, touch input is only available through automation events
+*       - Window management functions (fullscreen, position, icons, monitors...) are no-ops
+*       - System clock mode relies on clock_gettime() (POSIX, MinGW)
+*
+*   POSSIBLE IMPROVEMENTS:
+*       - Offscreen GPU rendering through EGL surfaceless contexts
+*
+*   ADDITIONAL NOTES:
+*       - TRACELOG() function is located in raylib [utils] module
+*       - Frames are converted to RGBA8 when GetHeadlessFrameBuffer() asks for them, so frames nobody
+*         reads cost nothing, and only the regions rlsw reports as changed since the previous read
+*         are copied (see SW_DAMAGE_TRACKING)
+*       - By default time comes from a virtual clock: every presented frame advances it by a fixed step
+*         and WaitTime() advances it instead of sleeping, so a SetTargetFPS() game runs as fast as it can
+*         render while GetTime()/GetFrameTime() behave as if it was running at its target speed
+*
+*   CONFIGURATION:
+*       #define HEADLESS_MAX_QUEUED_EVENTS
+*           Capacity of the programmatic input events queue (default: 512)
+*
+*       #define HEADLESS_DEFAULT_TIME_STEP
+*           Virtual clock step per presented frame in seconds, 0 to use the system clock (default: 1/60)
+*
+*   DEPENDENCIES:
+*       - rlsw: Software renderer (raylib/src/external/rlsw.h)
+*       - gestures: Gestures system for touch-ready devices (or simulated from mouse inputs)
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2013-2025 Ramon Santamaria (@raysan5) and contributors
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#if !defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    #error "PLATFORM_HEADLESS requires GRAPHICS_API_OPENGL_11_SOFTWARE"
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef HEADLESS_MAX_QUEUED_EVENTS
+    #define HEADLESS_MAX_QUEUED_EVENTS      512         // Maximum number of input events waiting in the queue
+#endif
+#ifndef HEADLESS_DEFAULT_TIME_STEP
+    #define HEADLESS_DEFAULT_TIME_STEP      (1.0/60.0)  // Virtual clock step per presented frame (seconds)
+#endif
+
+#define MAX_PRESENT_RECTS                   64          // Changed frame rectangles copied per frame, more are merged into one
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Programmatic input event type
+typedef enum {
+    HEADLESS_EVENT_KEY = 0,             // params[0]: key, params[1]: down
+    HEADLESS_EVENT_CHAR,                // params[0]: codepoint
+    HEADLESS_EVENT_MOUSE_POSITION,      // values[0]: x, values[1]: y
+    HEADLESS_EVENT_MOUSE_BUTTON,        // params[0]: button, params[1]: down
+    HEADLESS_EVENT_MOUSE_WHEEL,         // values[0]: x delta, values[1]: y delta
+    HEADLESS_EVENT_GAMEPAD_BUTTON,      // params[0]: gamepad, params[1]: button, params[2]: down
+    HEADLESS_EVENT_GAMEPAD_AXIS,        // params[0]: gamepad, params[1]: axis, values[0]: value
+    HEADLESS_EVENT_DELAY,               // params[0]: frames to wait before next events
+    HEADLESS_EVENT_CLOSE                // no params
+} HeadlessEventType;
+
+// Programmatic input event
+typedef struct {
+    int type;                           // Event type (HeadlessEventType)
+    int params[3];                      // Integer parameters
+    float values[2];                    // Float parameters
+} HeadlessEvent;
+
+typedef struct {
+    // Frame output
+    unsigned char *pixels;              // Last presented frame converted to RGBA8
+    bool pixelsValid;                   // Pixels hold the last presented frame
+    int pixelsWidth;                    // Allocated frame width
+    int pixelsHeight;                   // Allocated frame height
+    unsigned int frameCount;            // Frames presented since InitPlatform()
+    HeadlessFrameCallback frameCallback; // Callback run after every presented frame
+
+    // Timing
+    double timeStep;                    // Virtual clock step per frame, 0 for system clock
+    double virtualTime;                 // Virtual clock time (seconds)
+
+    // Programmatic input queue (ring buffer)
+    HeadlessEvent queue[HEADLESS_MAX_QUEUED_EVENTS];
+    int queueHead;                      // Next event to apply
+    int queueCount;                     // Events waiting in the queue
+
+    // Automation events replay
+    AutomationEventList *eventList;     // Events list to replay, NULL if none
+    unsigned int eventIndex;            // Next event to replay
+} PlatformData;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+extern CoreData CORE;                   // Global CORE state context
+
+static PlatformData platform = { 0 };   // Platform specific data
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
+void ClosePlatform(void);        // Close platform
+
+static bool HeadlessWaitTime(double seconds);                   // Advance virtual clock instead of waiting (required by WaitTime())
+static void PushHeadlessEvent(HeadlessEvent event);             // Add event to programmatic input queue
+static void ProcessHeadlessEvent(const HeadlessEvent *event);   // Apply programmatic input event to CORE input state
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// NOTE: Functions declaration is provided by raylib.h
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Window and Graphics Device
+//----------------------------------------------------------------------------------
+
+// Check if application should close
+bool WindowShouldClose(void)
+{
+    if (CORE.Window.ready) return CORE.Window.shouldClose;
+    else return true;
+}
+
+// Toggle fullscreen mode
+void ToggleFullscreen(void)
+{
+    TRACELOG(LOG_WARNING, "ToggleFullscreen() not available on target platform");
+}
+
+// Toggle borderless windowed mode
+void ToggleBorderlessWindowed(void)
+{
+    TRACELOG(LOG_WARNING, "ToggleBorderlessWindowed() not available on target platform");
+}
+
+// Set window state: maximized, if resizable
+void MaximizeWindow(void)
+{
+    TRACELOG(LOG_WARNING, "MaximizeWindow() not available on target platform");
+}
+
+// Set window state: minimized
+void MinimizeWindow(void)
+{
+    TRACELOG(LOG_WARNING, "MinimizeWindow() not available on target platform");
+}
+
+// Restore window from being minimized/maximized
+void RestoreWindow(void)
+{
+    TRACELOG(LOG_WARNING, "RestoreWindow() not available on target platform");
+}
+
+// Set window configuration state using flags
+void SetWindowState(unsigned int flags)
+{
+    TRACELOG(LOG_WARNING, "SetWindowState() not available on target platform");
+}
+
+// Clear window configuration state flags
+void ClearWindowState(unsigned int flags)
+{
+    TRACELOG(LOG_WARNING, "ClearWindowState() not available on target platform");
+}
+
+// Set icon for window
+void SetWindowIcon(Image image)
+{
+    TRACELOG(LOG_WARNING, "SetWindowIcon() not available on target platform");
+}
+
+// Set icon for window
+void SetWindowIcons(Image *images, int count)
+{
+    TRACELOG(LOG_WARNING, "SetWindowIcons() not available on target platform");
+}
+
+// Set title for window
+void SetWindowTitle(const char *title)
+{
+    CORE.Window.title = title;
+}
+
+// Set window position on screen (windowed mode)
+void SetWindowPosition(int x, int y)
+{
+    TRACELOG(LOG_WARNING, "SetWindowPosition() not available on target platform");
+}
+
+// Set monitor for the current window
+void SetWindowMonitor(int monitor)
+{
+    TRACELOG(LOG_WARNING, "SetWindowMonitor() not available on target platform");
+}
+
+// Set window minimum dimensions (FLAG_WINDOW_RESIZABLE)
+void SetWindowMinSize(int width, int height)
+{
+    CORE.Window.screenMin.width = width;
+    CORE.Window.screenMin.height = height;
+}
+
+// Set window maximum dimensions (FLAG_WINDOW_RESIZABLE)
+void SetWindowMaxSize(int width, int height)
+{
+    CORE.Window.screenMax.width = width;
+    CORE.Window.screenMax.height = height;
+}
+
+// Set window dimensions
+// NOTE: Resizes rlsw framebuffer, frame output follows on next presented frame
+void SetWindowSize(int width, int height)
+{
+    if ((width <= 0) || (height <= 0)) return;
+
+    rlResizeFramebuffer(width, height);
+    SetupViewport(width, height);
+
+    CORE.Window.screen.width = width;
+    CORE.Window.screen.height = height;
+    CORE.Window.display.width = width;
+    CORE.Window.display.height = height;
+    CORE.Window.currentFbo.width = width;
+    CORE.Window.currentFbo.height = height;
+    CORE.Window.resizedLastFrame = true;
+}
+
+// Set window opacity, value opacity is between 0.0 and 1.0
+void SetWindowOpacity(float opacity)
+{
+    TRACELOG(LOG_WARNING, "SetWindowOpacity() not available on target platform");
+}
+
+// Set window focused
+void SetWindowFocused(void)
+{
+    TRACELOG(LOG_WARNING, "SetWindowFocused() not available on target platform");
+}
+
+// Get native window handle
+void *GetWindowHandle(void)
+{
+    return NULL;
+}
+
+// Get number of monitors
+int GetMonitorCount(void)
+{
+    return 1;
+}
+
+// Get current monitor where window is placed
+int GetCurrentMonitor(void)
+{
+    return 0;
+}
+
+// Get selected monitor position
+Vector2 GetMonitorPosition(int monitor)
+{
+    return (Vector2){ 0, 0 };
+}
+
+// Get selected monitor width (currently used by monitor)
+// NOTE: Virtual display matches the screen size
+int GetMonitorWidth(int monitor)
+{
+    return CORE.Window.display.width;
+}
+
+// Get selected monitor height (currently used by monitor)
+int GetMonitorHeight(int monitor)
+{
+    return CORE.Window.display.height;
+}
+
+// Get selected monitor physical width in millimetres
+int GetMonitorPhysicalWidth(int monitor)
+{
+    TRACELOG(LOG_WARNING, "GetMonitorPhysicalWidth() not implemented on target platform");
+    return 0;
+}
+
+// Get selected monitor physical height in millimetres
+int GetMonitorPhysicalHeight(int monitor)
+{
+    TRACELOG(LOG_WARNING, "GetMonitorPhysicalHeight() not implemented on target platform");
+    return 0;
+}
+
+// Get selected monitor refresh rate
+// NOTE: Virtual clock refresh rate, 0 when using the system clock
+int GetMonitorRefreshRate(int monitor)
+{
+    if (platform.timeStep > 0.0) return (int)(1.0/platform.timeStep + 0.5);
+    else return 0;
+}
+
+// Get the human-readable, UTF-8 encoded name of the selected monitor
+const char *GetMonitorName(int monitor)
+{
+    return "Headless";
+}
+
+// Get window position XY on monitor
+Vector2 GetWindowPosition(void)
+{
+    return (Vector2){ 0, 0 };
+}
+
+// Get window scale DPI factor for current monitor
+Vector2 GetWindowScaleDPI(void)
+{
+    return (Vector2){ 1.0f, 1.0f };
+}
+
+// Set clipboard text content
+void SetClipboardText(const char *text)
+{
+    TRACELOG(LOG_WARNING, "SetClipboardText() not implemented on target platform");
+}
+
+// Get clipboard text content
+const char *GetClipboardText(void)
+{
+    TRACELOG(LOG_WARNING, "GetClipboardText() not implemented on target platform");
+    return NULL;
+}
+
+// Get clipboard image
+Image GetClipboardImage(void)
+{
+    Image image = { 0 };
+
+    TRACELOG(LOG_WARNING, "GetClipboardImage() not implemented on target platform");
+
+    return image;
+}
+
+// Show mouse cursor
+void ShowCursor(void)
+{
+    CORE.Input.Mouse.cursorHidden = false;
+}
+
+// Hides mouse cursor
+void HideCursor(void)
+{
+    CORE.Input.Mouse.cursorHidden = true;
+}
+
+// Enables cursor (unlock cursor)
+void EnableCursor(void)
+{
+    // Set cursor position in the middle
+    SetMousePosition(CORE.Window.screen.width/2, CORE.Window.screen.height/2);
+
+    CORE.Input.Mouse.cursorHidden = false;
+    CORE.Input.Mouse.cursorLocked = false;
+}
+
+// Disables cursor (lock cursor)
+void DisableCursor(void)
+{
+    // Set cursor position in the middle
+    SetMousePosition(CORE.Window.screen.width/2, CORE.Window.screen.height/2);
+
+    CORE.Input.Mouse.cursorHidden = true;
+    CORE.Input.Mouse.cursorLocked = true;
+}
+
+// Swap back buffer with front buffer (screen drawing)
+// NOTE: There is no front buffer, GetHeadlessFrameBuffer() reads the frame on request
+void SwapScreenBuffer(void)
+{
+    rlFlushFramebuffer();   // Deferred rasterization must not carry over into the next frame
+    platform.pixelsValid = false;
+    platform.frameCount++;
+
+    // Virtual clock: presenting a frame takes exactly one time step
+    if (platform.timeStep > 0.0) platform.virtualTime += platform.timeStep;
+
+    if (platform.frameCallback != NULL) platform.frameCallback(platform.frameCount);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Misc
+//----------------------------------------------------------------------------------
+
+// Get elapsed time measure in seconds since InitTimer()
+double GetTime(void)
+{
+    if (platform.timeStep > 0.0) return platform.virtualTime;
+
+    double time = 0.0;
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    unsigned long long int nanoSeconds = (unsigned long long int)ts.tv_sec*1000000000LLU + (unsigned long long int)ts.tv_nsec;
+
+    time = (double)(nanoSeconds - CORE.Time.base)*1e-9;  // Elapsed time since InitTimer()
+
+    return time;
+}
+
+// Open URL with default system browser (if available)
+// NOTE: There is no user to see it, only logged
+void OpenURL(const char *url)
+{
+    // Security check to (partially) avoid malicious code on target platform
+    if (strchr(url, '\'') != NULL) TRACELOG(LOG_WARNING, "SYSTEM: Provided URL could be potentially malicious, avoid [\'] character");
+    else TRACELOG(LOG_INFO, "SYSTEM: OpenURL() ignored on headless platform: %s", url);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Headless host interface
+//----------------------------------------------------------------------------------
+
+// Get last presented frame, RGBA8 with top-left origin
+// NOTE: Frame is converted on request, so frames nobody reads cost nothing. rlsw keeps track of
+// the regions changed since the last read (see SW_DAMAGE_TRACKING), only those are copied
+const unsigned char *GetHeadlessFrameBuffer(int *width, int *height)
+{
+    int frameWidth = CORE.Window.render.width;
+    int frameHeight = CORE.Window.render.height;
+    int rects[4*MAX_PRESENT_RECTS] = { 0 };
+    int count = 0;
+
+    if ((platform.pixels == NULL) || (platform.pixelsWidth != frameWidth) || (platform.pixelsHeight != frameHeight))
+    {
+        RL_FREE(platform.pixels);
+        platform.pixels = (unsigned char *)RL_MALLOC(frameWidth*frameHeight*4);
+        platform.pixelsWidth = frameWidth;
+        platform.pixelsHeight = frameHeight;
+
+        // New frame output, copied entirely
+        if (platform.pixels != NULL)
+        {
+            rlCopyFramebuffer(0, 0, frameWidth, frameHeight, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, platform.pixels);
+
+            rects[2] = frameWidth;
+            rects[3] = frameHeight;
+            count = 1;
+        }
+
+        platform.pixelsValid = (platform.pixels != NULL);
+    }
+    else if (!platform.pixelsValid)
+    {
+        count = rlCopyFramebufferDamage(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, frameWidth*4, platform.pixels, rects, MAX_PRESENT_RECTS);
+        platform.pixelsValid = true;
+    }
+
+#if SW_GL_FRAMEBUFFER_COPY_BGRA
+    // NOTE: rlsw copies in window surface order (BGRA) by default, host expects RGBA
+    for (int r = 0; r < count; r++)
+    {
+        for (int y = rects[4*r + 1]; y < rects[4*r + 1] + rects[4*r + 3]; y++)
+        {
+            unsigned char *row = platform.pixels + (y*frameWidth + rects[4*r])*4;
+
+            for (int i = 0; i < rects[4*r + 2]*4; i += 4)
+            {
+                unsigned char blue = row[i];
+                row[i] = row[i + 2];
+                row[i + 2] = blue;
+            }
+        }
+    }
+#endif
+
+    if (width != NULL) *width = platform.pixelsWidth;
+    if (height != NULL) *height = platform.pixelsHeight;
+
+    return platform.pixels;
+}
+
+// Get number of frames presented since InitWindow()
+unsigned int GetHeadlessFrameCount(void)
+{
+    return platform.frameCount;
+}
+
+// Set callback run after every presented frame
+void SetHeadlessFrameCallback(HeadlessFrameCallback callback)
+{
+    platform.frameCallback = callback;
+}
+
+// Set virtual clock step per presented frame (seconds), 0 to use the system clock
+void SetHeadlessTimeStep(double seconds)
+{
+    if (seconds < 0.0) seconds = 0.0;
+
+    // Keep time continuous when switching clocks
+    double time = GetTime();
+
+    if ((seconds <= 0.0) && (platform.timeStep > 0.0))
+    {
+        // Move system clock base so it continues from current virtual time
+        struct timespec ts = { 0 };
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        unsigned long long int nanoSeconds = (unsigned long long int)ts.tv_sec*1000000000LLU + (unsigned long long int)ts.tv_nsec;
+
+        CORE.Time.base = nanoSeconds - (unsigned long long int)(time*1e9);
+    }
+
+    platform.timeStep = seconds;
+    platform.virtualTime = time;
+}
+
+// Set automation events list to replay, events are applied by frame on PollInputEvents()
+// NOTE: Replay starts from the list first event, frames are compared with the internal frame counter
+void SetHeadlessAutomationEventList(AutomationEventList *list)
+{
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    platform.eventList = list;
+    platform.eventIndex = 0;
+#else
+    TRACELOG(LOG_WARNING, "SetHeadlessAutomationEventList() requires SUPPORT_AUTOMATION_EVENTS");
+#endif
+}
+
+// Push key down/up event
+void PushHeadlessKey(int key, bool down)
+{
+    HeadlessEvent event = { HEADLESS_EVENT_KEY, { key, down, 0 }, { 0 } };
+    PushHeadlessEvent(event);
+}
+
+// Push character (unicode codepoint) event
+void PushHeadlessChar(int codepoint)
+{
+    HeadlessEvent event = { HEADLESS_EVENT_CHAR, { codepoint, 0, 0 }, { 0 } };
+    PushHeadlessEvent(event);
+}
+
+// Push mouse position event
+void PushHeadlessMousePosition(float x, float y)
+{
+    HeadlessEvent event = { HEADLESS_EVENT_MOUSE_POSITION, { 0 }, { x, y } };
+    PushHeadlessEvent(event);
+}
+
+// Push mouse button down/up event
+void PushHeadlessMouseButton(int button, bool down)
+{
+    HeadlessEvent event = { HEADLESS_EVENT_MOUSE_BUTTON, { button, down, 0 }, { 0 } };
+    PushHeadlessEvent(event);
+}
+
+// Push mouse wheel movement event
+void PushHeadlessMouseWheel(float x, float y)
+{
+    HeadlessEvent event = { HEADLESS_EVENT_MOUSE_WHEEL, { 0 }, { x, y } };
+    PushHeadlessEvent(event);
+}
+
+// Push gamepad button down/up event, gamepad is connected on its first event
+void PushHeadlessGamepadButton(int gamepad, int button, bool down)
+{
+    HeadlessEvent event = { HEADLESS_EVENT_GAMEPAD_BUTTON, { gamepad, button, down }, { 0 } };
+    PushHeadlessEvent(event);
+}
+
+// Push gamepad axis movement event, value in [-1.0f..1.0f]
+void PushHeadlessGamepadAxis(int gamepad, int axis, float value)
+{
+    HeadlessEvent event = { HEADLESS_EVENT_GAMEPAD_AXIS, { gamepad, axis, 0 }, { value, 0.0f } };
+    PushHeadlessEvent(event);
+}
+
+// Push delay, events pushed after it are applied the given number of frames later
+void PushHeadlessDelay(int frames)
+{
+    if (frames <= 0) return;
+
+    HeadlessEvent event = { HEADLESS_EVENT_DELAY, { frames, 0, 0 }, { 0 } };
+    PushHeadlessEvent(event);
+}
+
+// Push window close request, WindowShouldClose() returns true once it is applied
+void PushHeadlessClose(void)
+{
+    HeadlessEvent event = { HEADLESS_EVENT_CLOSE, { 0 }, { 0 } };
+    PushHeadlessEvent(event);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Inputs
+//----------------------------------------------------------------------------------
+
+// Set internal gamepad mappings
+int SetGamepadMappings(const char *mappings)
+{
+    TRACELOG(LOG_WARNING, "SetGamepadMappings() not implemented on target platform");
+    return 0;
+}
+
+// Set gamepad vibration
+void SetGamepadVibration(int gamepad, float leftMotor, float rightMotor, float duration)
+{
+    // Nothing to vibrate, ignored
+}
+
+// Set mouse position XY
+void SetMousePosition(int x, int y)
+{
+    CORE.Input.Mouse.currentPosition = (Vector2){ (float)x, (float)y };
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+}
+
+// Set mouse cursor
+void SetMouseCursor(int cursor)
+{
+    CORE.Input.Mouse.cursor = cursor;
+}
+
+// Get physical key name.
+const char *GetKeyName(int key)
+{
+    TRACELOG(LOG_WARNING, "GetKeyName() not implemented on target platform");
+    return "";
+}
+
+// Register all input events
+// NOTE: Queued programmatic events are applied first, then automation events for the next frame
+void PollInputEvents(void)
+{
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    // NOTE: Gestures update must be called every frame to reset gestures correctly
+    // because ProcessGestureEvent() is just called on an event, not every frame
+    UpdateGestures();
+#endif
+
+    // Reset keys/chars pressed registered
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+
+    // Reset last gamepad button/axis registered state
+    CORE.Input.Gamepad.lastButtonPressed = 0; // GAMEPAD_BUTTON_UNKNOWN
+
+    // Reset mouse wheel
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+
+    // Register previous mouse position
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+
+    // Register previous touch states
+    for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
+
+    // Register previous keys states
+    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+    {
+        CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+        CORE.Input.Keyboard.keyRepeatInFrame[i] = 0;
+    }
+
+    // Register previous mouse states
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+
+    // Register previous gamepad button states
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+    }
+
+    CORE.Window.resizedLastFrame = false;
+
+    // Apply programmatic events until queue is empty or a delay is pending
+    while (platform.queueCount > 0)
+    {
+        HeadlessEvent *event = &platform.queue[platform.queueHead];
+
+        if ((event->type == HEADLESS_EVENT_DELAY) && (event->params[0] > 0))
+        {
+            event->params[0]--;
+            break;
+        }
+
+        ProcessHeadlessEvent(event);
+
+        platform.queueHead = (platform.queueHead + 1)%HEADLESS_MAX_QUEUED_EVENTS;
+        platform.queueCount--;
+    }
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    // Replay automation events recorded for the frame about to start
+    // NOTE: Events are recorded on EndDrawing() with the input state polled on previous frame
+    if (platform.eventList != NULL)
+    {
+        while ((platform.eventIndex < platform.eventList->count) &&
+               (platform.eventList->events[platform.eventIndex].frame <= CORE.Time.frameCounter + 1))
+        {
+            PlayAutomationEvent(platform.eventList->events[platform.eventIndex]);
+            platform.eventIndex++;
+        }
+    }
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Initialize platform: graphics, inputs and more
+int InitPlatform(void)
+{
+    // There is no display, it is as big as the requested screen
+    if ((CORE.Window.screen.width <= 0) || (CORE.Window.screen.height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Headless platform requires a valid screen size");
+        return -1;
+    }
+
+    CORE.Window.display.width = CORE.Window.screen.width;
+    CORE.Window.display.height = CORE.Window.screen.height;
+
+    // NOTE: rlsw framebuffer is created by rlglInit() with currentFbo size
+    CORE.Window.ready = true;
+
+    CORE.Window.render.width = CORE.Window.screen.width;
+    CORE.Window.render.height = CORE.Window.screen.height;
+    CORE.Window.currentFbo.width = CORE.Window.render.width;
+    CORE.Window.currentFbo.height = CORE.Window.render.height;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Device initialized successfully");
+    TRACELOG(LOG_INFO, "    > Display size: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
+    TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+    TRACELOG(LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
+    TRACELOG(LOG_INFO, "    > Viewport offsets: %i, %i", CORE.Window.renderOffset.x, CORE.Window.renderOffset.y);
+
+    // Initialize input events system
+    //----------------------------------------------------------------------------
+    platform.queueHead = 0;
+    platform.queueCount = 0;
+    platform.eventList = NULL;
+    platform.eventIndex = 0;
+    //----------------------------------------------------------------------------
+
+    // Initialize timing system
+    //----------------------------------------------------------------------------
+    platform.timeStep = HEADLESS_DEFAULT_TIME_STEP;
+    platform.virtualTime = 0.0;
+    platform.frameCount = 0;
+    InitTimer();
+    //----------------------------------------------------------------------------
+
+    // Initialize storage system
+    //----------------------------------------------------------------------------
+    CORE.Storage.basePath = GetWorkingDirectory();
+    //----------------------------------------------------------------------------
+
+    if (platform.timeStep > 0.0) TRACELOG(LOG_INFO, "PLATFORM: HEADLESS: Initialized successfully (virtual clock: %.3f ms per frame)", platform.timeStep*1000.0);
+    else TRACELOG(LOG_INFO, "PLATFORM: HEADLESS: Initialized successfully (system clock)");
+
+    return 0;
+}
+
+// Close platform
+void ClosePlatform(void)
+{
+    RL_FREE(platform.pixels);
+    platform.pixels = NULL;
+    platform.pixelsWidth = 0;
+    platform.pixelsHeight = 0;
+    platform.pixelsValid = false;
+    platform.frameCallback = NULL;
+    platform.eventList = NULL;
+    platform.queueCount = 0;
+
+    CORE.Window.ready = false;
+}
+
+// Advance virtual clock instead of waiting
+// NOTE: Returns false when the system clock is used and WaitTime() must really wait
+static bool HeadlessWaitTime(double seconds)
+{
+    if (platform.timeStep <= 0.0) return false;
+
+    platform.virtualTime += seconds;
+
+    return true;
+}
+
+// Add event to programmatic input queue
+static void PushHeadlessEvent(HeadlessEvent event)
+{
+    if (platform.queueCount >= HEADLESS_MAX_QUEUED_EVENTS)
+    {
+        TRACELOG(LOG_WARNING, "INPUT: Headless events queue is full, event dropped");
+        return;
+    }
+
+    platform.queue[(platform.queueHead + platform.queueCount)%HEADLESS_MAX_QUEUED_EVENTS] = event;
+    platform.queueCount++;
+}
+
+// Apply programmatic input event to CORE input state
+static void ProcessHeadlessEvent(const HeadlessEvent *event)
+{
+    switch (event->type)
+    {
+        case HEADLESS_EVENT_KEY:
+        {
+            int key = event->params[0];
+            if ((key < 0) || (key >= MAX_KEYBOARD_KEYS)) break;     // Security check
+
+            if (event->params[1])
+            {
+                // Already down is a key repeat, like OS auto-repeat
+                if (CORE.Input.Keyboard.currentKeyState[key]) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
+                else if (CORE.Input.Keyboard.keyPressedQueueCount < MAX_KEY_PRESSED_QUEUE)
+                {
+                    // Add key to the queue
+                    CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = key;
+                    CORE.Input.Keyboard.keyPressedQueueCount++;
+                }
+
+                CORE.Input.Keyboard.currentKeyState[key] = 1;
+
+                // Check the exit key to set close window
+                if (key == CORE.Input.Keyboard.exitKey) CORE.Window.shouldClose = true;
+            }
+            else CORE.Input.Keyboard.currentKeyState[key] = 0;
+        } break;
+        case HEADLESS_EVENT_CHAR:
+        {
+            // Check if there is space available in the queue
+            if (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
+            {
+                // Add character to the queue
+                CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = event->params[0];
+                CORE.Input.Keyboard.charPressedQueueCount++;
+            }
+        } break;
+        case HEADLESS_EVENT_MOUSE_POSITION:
+        {
+            CORE.Input.Mouse.currentPosition.x = event->values[0];
+            CORE.Input.Mouse.currentPosition.y = event->values[1];
+            CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
+        } break;
+        case HEADLESS_EVENT_MOUSE_BUTTON:
+        {
+            int button = event->params[0];
+            if ((button < 0) || (button >= MAX_MOUSE_BUTTONS)) break;   // Security check
+
+            CORE.Input.Mouse.currentButtonState[button] = (char)event->params[1];
+            if (button < MAX_TOUCH_POINTS) CORE.Input.Touch.currentTouchState[button] = (char)event->params[1];
+        } break;
+        case HEADLESS_EVENT_MOUSE_WHEEL:
+        {
+            CORE.Input.Mouse.currentWheelMove.x += event->values[0];
+            CORE.Input.Mouse.currentWheelMove.y += event->values[1];
+        } break;
+        case HEADLESS_EVENT_GAMEPAD_BUTTON:
+        {
+            int gamepad = event->params[0];
+            int button = event->params[1];
+            if ((gamepad < 0) || (gamepad >= MAX_GAMEPADS) || (button < 0) || (button >= MAX_GAMEPAD_BUTTONS)) break;   // Security check
+
+            if (!CORE.Input.Gamepad.ready[gamepad])
+            {
+                CORE.Input.Gamepad.ready[gamepad] = true;
+                snprintf(CORE.Input.Gamepad.name[gamepad], MAX_GAMEPAD_NAME_LENGTH, "Headless Gamepad %i", gamepad);
+            }
+
+            CORE.Input.Gamepad.currentButtonState[gamepad][button] = (char)event->params[2];
+            if (event->params[2]) CORE.Input.Gamepad.lastButtonPressed = button;
+        } break;
+        case HEADLESS_EVENT_GAMEPAD_AXIS:
+        {
+            int gamepad = event->params[0];
+            int axis = event->params[1];
+            if ((gamepad < 0) || (gamepad >= MAX_GAMEPADS) || (axis < 0) || (axis >= MAX_GAMEPAD_AXES)) break;   // Security check
+
+            if (!CORE.Input.Gamepad.ready[gamepad])
+            {
+                CORE.Input.Gamepad.ready[gamepad] = true;
+                snprintf(CORE.Input.Gamepad.name[gamepad], MAX_GAMEPAD_NAME_LENGTH, "Headless Gamepad %i", gamepad);
+            }
+
+            if (CORE.Input.Gamepad.axisCount[gamepad] < axis + 1) CORE.Input.Gamepad.axisCount[gamepad] = axis + 1;
+            CORE.Input.Gamepad.axisState[gamepad][axis] = event->values[0];
+        } break;
+        case HEADLESS_EVENT_CLOSE: CORE.Window.shouldClose = true; break;
+        default: break;
+    }
+}
+
+// EOF
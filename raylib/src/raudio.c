@@ -184,6 +184,18 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
 
+// Vectorized mixing path, selected at compile time (scalar loop otherwise)
+#if defined(__AVX__)
+    #include <immintrin.h>              // Required for: AVX intrinsics [Used in MixAudioSamples()]
+    #define RAUDIO_MIX_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>              // Required for: SSE2 intrinsics [Used in MixAudioSamples()]
+    #define RAUDIO_MIX_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>               // Required for: NEON intrinsics [Used in MixAudioSamples()]
+    #define RAUDIO_MIX_NEON
+#endif
+
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
@@ -299,6 +311,19 @@ typedef struct tagBITMAPINFOHEADER {
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
 
+#if defined(PLATFORM_WEB)
+    #undef SUPPORT_MUSIC_DECODE_THREAD              // No guaranteed threads on web, UpdateMusicStream() decodes
+#endif
+#ifndef MUSIC_DECODE_BUFFER_MS
+    #define MUSIC_DECODE_BUFFER_MS          1000    // Decoded music kept ahead of playback (milliseconds)
+#endif
+#ifndef MUSIC_DECODE_SLEEP_MS
+    #define MUSIC_DECODE_SLEEP_MS              5    // Decoder thread wait while the ring buffer is full
+#endif
+#ifndef MUSIC_DECODE_CHUNK_FRAMES
+    #define MUSIC_DECODE_CHUNK_FRAMES       4096    // Max frames decoded between control request checks
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -360,6 +385,9 @@ struct rAudioBuffer {
     unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    struct rMusicDecoder *decoder;  // Music decoder thread feeding this buffer, NULL if none
+#endif
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
@@ -373,6 +401,25 @@ struct rAudioProcessor {
     rAudioProcessor *prev;          // Previous audio processor on the list
 };
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+// Music decoder, decodes a music stream on its own thread
+// NOTE: The decoder thread is the only ring writer and the mixer (audio thread) the only reader,
+// the game thread only posts requests through the atomic fields
+typedef struct rMusicDecoder {
+    Music music;                        // Music copy, ctxData is only touched by the decoder thread
+    ma_pcm_rb ring;                     // Decoded frames in the stream internal format (lock-free SPSC)
+    ma_thread thread;                   // Decoder thread
+
+    MA_ATOMIC(4, ma_uint32) running;    // Cleared to end the decoder thread
+    MA_ATOMIC(4, ma_uint32) looping;    // Music looping, updated on PlayMusicStream()
+    MA_ATOMIC(4, ma_uint32) seekFrame;  // Pending seek request: frame + 1, 0 if none
+    MA_ATOMIC(4, ma_uint32) endOfMusic; // Non-looping music decoded up to the last frame
+
+    unsigned int framesDecoded;         // Decoder position (decoder thread only)
+    unsigned int framesPlayed;          // Mixer position (protected by audio lock)
+} rMusicDecoder;
+#endif
+
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
 // Audio data context
@@ -417,11 +464,23 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd);
 
 static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
 static void StopAudioBufferInLockedState(AudioBuffer *buffer);
 static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
 
+static void DecodeMusicFrames(Music music, void *framesOut, unsigned int frameCount);   // Decode frames from music context, wraps at the end
+static void RewindMusicFrames(Music music);                                             // Rewind music context to the first frame
+static unsigned int SeekMusicFrames(Music music, unsigned int positionInFrames);        // Seek music context, returns actual position
+
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+static void LoadMusicDecoder(Music music);                                              // Start decoder thread for a music stream
+static void UnloadMusicDecoder(Music music);                                            // Stop decoder thread of a music stream
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *data);
+#endif
+
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
 static const char *GetFileExtension(const char *fileName);          // Get pointer to extension for a filename string (includes the dot: .png)
@@ -560,6 +619,19 @@ float GetMasterVolume(void)
     return volume;
 }
 
+// Get audio device mixing sample rate
+// NOTE: Returns 0 if the device is not initialized
+unsigned int GetAudioDeviceSampleRate(void)
+{
+    return AUDIO.System.isReady? AUDIO.System.device.sampleRate : 0;
+}
+
+// Get audio device mixing channels
+unsigned int GetAudioDeviceChannels(void)
+{
+    return AUDIO_DEVICE_CHANNELS;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -597,6 +669,9 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    audioBuffer->decoder = NULL;
+#endif
 
     audioBuffer->playing = false;
     audioBuffer->paused = false;
@@ -1506,6 +1581,10 @@ Music LoadMusicStream(const char *fileName)
 #endif
     else TRACELOG(LOG_WARNING, "STREAM: [%s] File format not supported", fileName);
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    if (musicLoaded) LoadMusicDecoder(music);
+#endif
+
     if (!musicLoaded)
     {
         TRACELOG(LOG_WARNING, "FILEIO: [%s] Music file could not be opened", fileName);
@@ -1720,6 +1799,10 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
 #endif
     else TRACELOG(LOG_WARNING, "STREAM: Data format not supported");
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    if (musicLoaded) LoadMusicDecoder(music);
+#endif
+
     if (!musicLoaded)
     {
         TRACELOG(LOG_WARNING, "FILEIO: Music data could not be loaded");
@@ -1750,6 +1833,9 @@ bool IsMusicValid(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    UnloadMusicDecoder(music);  // Decoder thread uses the context, it goes first
+#endif
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1783,6 +1869,11 @@ void UnloadMusicStream(Music music)
 void PlayMusicStream(Music music)
 {
     PlayAudioStream(music.stream);
+
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    // Music is passed by value, pick up looping changes made since loading
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL)) ma_atomic_store_32(&music.stream.buffer->decoder->looping, music.looping? 1 : 0);
+#endif
 }
 
 // Pause music playing
@@ -1802,31 +1893,16 @@ void StopMusicStream(Music music)
 {
     StopAudioStream(music.stream);
 
-    switch (music.ctxType)
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    // Decoder thread owns the context, request a rewind
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL))
     {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
+        ma_atomic_store_32(&music.stream.buffer->decoder->seekFrame, 1);
+        return;
     }
+#endif
+
+    RewindMusicFrames(music);
 }
 
 // Seek music to a certain position (in seconds)
@@ -1837,32 +1913,16 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
-    switch (music.ctxType)
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    // Decoder thread owns the context, request the seek
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL))
     {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames); break;
+        ma_atomic_store_32(&music.stream.buffer->decoder->seekFrame, positionInFrames + 1);
+        return;
+    }
 #endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA:
-        {
-            int qoaFrame = positionInFrames/QOA_FRAME_LEN;
-            qoaplay_seek_frame((qoaplay_desc *)music.ctxData, qoaFrame); // Seeks to QOA frame, not PCM frame
 
-            // We need to compute QOA frame number and update positionInFrames
-            positionInFrames = ((qoaplay_desc *)music.ctxData)->sample_position;
-        } break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, positionInFrames); break;
-#endif
-        default: break;
-    }
+    positionInFrames = SeekMusicFrames(music, positionInFrames);
 
     ma_mutex_lock(&AUDIO.System.lock);
     music.stream.buffer->framesProcessed = positionInFrames;
@@ -1875,6 +1935,9 @@ void SeekMusicStream(Music music, float position)
 void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    if (music.stream.buffer->decoder != NULL) return;   // Decoder thread keeps the stream fed
+#endif
     if (!music.stream.buffer->playing) return;
 
     ma_mutex_lock(&AUDIO.System.lock);
@@ -1917,116 +1980,7 @@ void UpdateMusicStream(Music music)
 
         if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
 
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
-
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
-
-            } break;
-        #endif
-            default: break;
-        }
+        DecodeMusicFrames(music, AUDIO.System.pcmBuffer, framesToStream);
 
         UpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
     }
@@ -2074,6 +2028,15 @@ float GetMusicTimePlayed(Music music)
     float secondsPlayed = 0.0f;
     if (music.stream.buffer != NULL)
     {
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+        if (music.stream.buffer->decoder != NULL)
+        {
+            ma_mutex_lock(&AUDIO.System.lock);
+            secondsPlayed = (float)music.stream.buffer->decoder->framesPlayed/music.stream.sampleRate;
+            ma_mutex_unlock(&AUDIO.System.lock);
+        }
+        else
+#endif
 #if defined(SUPPORT_FILEFORMAT_XM)
         if (music.ctxType == MUSIC_MODULE_XM)
         {
@@ -2364,6 +2327,11 @@ static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage)
 // Reads audio data from an AudioBuffer object in internal format
 static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
 {
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    // Music decoded on its own thread
+    if (audioBuffer->decoder != NULL) return ReadMusicDecoderFrames(audioBuffer, framesOut, frameCount);
+#endif
+
     // Using audio buffer callback
     if (audioBuffer->callback)
     {
@@ -2527,7 +2495,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 
                 while (framesToRead > 0)
                 {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+                    float tempBuffer[1024];         // Frames for stereo, only the frames read get mixed
 
                     ma_uint32 framesToReadRightNow = framesToRead;
                     if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
@@ -2611,32 +2579,63 @@ static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 fr
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
         const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+        // Interleaved stereo: even samples are left, odd samples are right
+        MixAudioSamples(framesOut, framesIn, frameCount*2, levels[0], levels[1]);
+    }
+    else  // We do not consider panning
+    {
+        // Output accumulates input multiplied by volume to provided output (usually 0)
+        MixAudioSamples(framesOut, framesIn, frameCount*channels, localVolume, localVolume);
+    }
+}
+
+// Accumulate samples scaled by gain into output, even and odd samples use their own gain
+// NOTE: Vector paths keep the same multiply-then-add order as the scalar loop, results are identical
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd)
+{
+    ma_uint32 i = 0;
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+#if defined(RAUDIO_MIX_AVX)
+    const __m256 gains = _mm256_setr_ps(gainEven, gainOdd, gainEven, gainOdd, gainEven, gainOdd, gainEven, gainOdd);
 
-            frameOut += 2;
-            frameIn += 2;
-        }
+    for (; (i + 16) <= sampleCount; i += 16)
+    {
+        __m256 out0 = _mm256_loadu_ps(samplesOut + i);
+        __m256 out1 = _mm256_loadu_ps(samplesOut + i + 8);
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_loadu_ps(samplesIn + i), gains));
+        out1 = _mm256_add_ps(out1, _mm256_mul_ps(_mm256_loadu_ps(samplesIn + i + 8), gains));
+        _mm256_storeu_ps(samplesOut + i, out0);
+        _mm256_storeu_ps(samplesOut + i + 8, out1);
     }
-    else  // We do not consider panning
+#elif defined(RAUDIO_MIX_SSE2)
+    const __m128 gains = _mm_setr_ps(gainEven, gainOdd, gainEven, gainOdd);
+
+    for (; (i + 8) <= sampleCount; i += 8)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+        __m128 out0 = _mm_loadu_ps(samplesOut + i);
+        __m128 out1 = _mm_loadu_ps(samplesOut + i + 4);
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_loadu_ps(samplesIn + i), gains));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_loadu_ps(samplesIn + i + 4), gains));
+        _mm_storeu_ps(samplesOut + i, out0);
+        _mm_storeu_ps(samplesOut + i + 4, out1);
+    }
+#elif defined(RAUDIO_MIX_NEON)
+    const float gainValues[4] = { gainEven, gainOdd, gainEven, gainOdd };
+    const float32x4_t gains = vld1q_f32(gainValues);
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
-        }
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        float32x4_t out0 = vld1q_f32(samplesOut + i);
+        float32x4_t out1 = vld1q_f32(samplesOut + i + 4);
+        out0 = vaddq_f32(out0, vmulq_f32(vld1q_f32(samplesIn + i), gains));
+        out1 = vaddq_f32(out1, vmulq_f32(vld1q_f32(samplesIn + i + 4), gains));
+        vst1q_f32(samplesOut + i, out0);
+        vst1q_f32(samplesOut + i + 4, out1);
     }
+#endif
+
+    // Remaining samples (vector loops stop on an even index, so parity is kept)
+    for (; i < sampleCount; i++) samplesOut[i] += samplesIn[i]*((i & 1)? gainOdd : gainEven);
 }
 
 // Check if an audio buffer is playing, assuming the audio system mutex has been locked
@@ -2715,6 +2714,361 @@ static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data,
     }
 }
 
+// Decode frames from the music context into framesOut (stream format)
+// NOTE: Decoders wrap to the start when reaching the end, callers limit frameCount for non-looping music
+static void DecodeMusicFrames(Music music, void *framesOut, unsigned int frameCount)
+{
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+
+    int frameCountStillNeeded = frameCount;
+    int frameCountReadTotal = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+            else if (music.stream.sampleSize == 32)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            while (true)
+            {
+                int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)framesOut + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)framesOut, frameCount);
+            frameCountReadTotal += frameCountRead;
+            /*
+            while (true)
+            {
+                int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)framesOut + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+            }
+            */
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drflac__seek_to_first_frame((drflac *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)framesOut, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)framesOut, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)framesOut, frameCount);
+            //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)framesOut, frameCount, 0);
+            //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+        } break;
+    #endif
+        default: break;
+    }
+}
+
+// Rewind music context to the first frame
+static void RewindMusicFrames(Music music)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+// Seek music context to a frame, returns the actual position
+// NOTE: QOA seeks to the start of the containing QOA frame
+static unsigned int SeekMusicFrames(Music music, unsigned int positionInFrames)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, positionInFrames); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            int qoaFrame = positionInFrames/QOA_FRAME_LEN;
+            qoaplay_seek_frame((qoaplay_desc *)music.ctxData, qoaFrame); // Seeks to QOA frame, not PCM frame
+
+            // We need to compute QOA frame number and update positionInFrames
+            positionInFrames = ((qoaplay_desc *)music.ctxData)->sample_position;
+        } break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, positionInFrames); break;
+#endif
+        default: break;
+    }
+
+    return positionInFrames;
+}
+
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+// Start the decoder thread of a music stream, it prefills the ring buffer right away
+// NOTE: On failure the music keeps being decoded by UpdateMusicStream()
+static void LoadMusicDecoder(Music music)
+{
+    if (music.stream.buffer == NULL) return;
+
+    rMusicDecoder *decoder = (rMusicDecoder *)RL_CALLOC(1, sizeof(rMusicDecoder));
+    decoder->music = music;
+
+    // Ring buffer holds frames in the stream internal format, converted by the mixer like any stream
+    ma_uint32 ringSizeInFrames = (ma_uint32)(((ma_uint64)music.stream.sampleRate*MUSIC_DECODE_BUFFER_MS)/1000);
+    if (ma_pcm_rb_init(music.stream.buffer->converter.formatIn, music.stream.buffer->converter.channelsIn, ringSizeInFrames, NULL, NULL, &decoder->ring) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder buffer");
+        RL_FREE(decoder);
+        return;
+    }
+
+    ma_atomic_store_32(&decoder->running, 1);
+    ma_atomic_store_32(&decoder->looping, music.looping? 1 : 0);
+
+    if (ma_thread_create(&decoder->thread, ma_thread_priority_normal, 0, MusicDecoderThread, decoder, NULL) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder thread");
+        ma_pcm_rb_uninit(&decoder->ring);
+        RL_FREE(decoder);
+        return;
+    }
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    music.stream.buffer->decoder = decoder;
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    TRACELOG(LOG_INFO, "STREAM: Music decoder thread started (%i ms buffer)", MUSIC_DECODE_BUFFER_MS);
+}
+
+// Stop the decoder thread of a music stream and release its ring buffer
+static void UnloadMusicDecoder(Music music)
+{
+    if ((music.stream.buffer == NULL) || (music.stream.buffer->decoder == NULL)) return;
+
+    rMusicDecoder *decoder = music.stream.buffer->decoder;
+
+    ma_atomic_store_32(&decoder->running, 0);
+    ma_thread_wait(&decoder->thread);
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    music.stream.buffer->decoder = NULL;
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    ma_pcm_rb_uninit(&decoder->ring);
+    RL_FREE(decoder);
+}
+
+// Read decoded music frames for mixing, assuming the audio system mutex has been locked
+// NOTE: Never waits for the decoder, missing frames are filled with silence
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+{
+    rMusicDecoder *decoder = audioBuffer->decoder;
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+
+    // Ring content is stale while a seek or rewind is pending
+    if (ma_atomic_load_32(&decoder->seekFrame) != 0)
+    {
+        memset(framesOut, 0, frameCount*frameSizeInBytes);
+        return frameCount;
+    }
+
+    ma_uint32 framesRead = 0;
+    while (framesRead < frameCount)
+    {
+        // Readable region can stop at the ring wrap point, so it may take two reads
+        ma_uint32 framesToRead = frameCount - framesRead;
+        void *framesIn = NULL;
+
+        if ((ma_pcm_rb_acquire_read(&decoder->ring, &framesToRead, &framesIn) != MA_SUCCESS) || (framesToRead == 0)) break;
+
+        memcpy((unsigned char *)framesOut + framesRead*frameSizeInBytes, framesIn, framesToRead*frameSizeInBytes);
+        ma_pcm_rb_commit_read(&decoder->ring, framesToRead);
+        framesRead += framesToRead;
+    }
+
+    audioBuffer->framesProcessed += framesRead;
+    decoder->framesPlayed += framesRead;
+    if (decoder->music.frameCount > 0) decoder->framesPlayed %= decoder->music.frameCount;
+
+    if (framesRead < frameCount)
+    {
+        memset((unsigned char *)framesOut + framesRead*frameSizeInBytes, 0, (frameCount - framesRead)*frameSizeInBytes);
+
+        // Non-looping music played to the end: stop it and have the decoder rewind for the next play
+        if (ma_atomic_load_32(&decoder->endOfMusic) && (ma_pcm_rb_available_read(&decoder->ring) == 0))
+        {
+            StopAudioBufferInLockedState(audioBuffer);
+            ma_atomic_store_32(&decoder->seekFrame, 1);
+            return framesRead;
+        }
+
+        // Otherwise the decoder fell behind, keep streaming silence
+        framesRead = frameCount;
+    }
+
+    return framesRead;
+}
+
+// Music decoder thread: keeps the ring buffer full and handles seek requests
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *data)
+{
+    rMusicDecoder *decoder = (rMusicDecoder *)data;
+    Music music = decoder->music;
+
+    while (ma_atomic_load_32(&decoder->running))
+    {
+        // NOTE: The request stays pending until the seek is done, the mixer plays silence meanwhile
+        ma_uint32 seekFrame = ma_atomic_load_32(&decoder->seekFrame);
+        if (seekFrame != 0)
+        {
+            unsigned int positionInFrames = seekFrame - 1;
+
+            if (positionInFrames == 0) RewindMusicFrames(music);
+            else positionInFrames = SeekMusicFrames(music, positionInFrames);
+
+            decoder->framesDecoded = positionInFrames;
+            ma_atomic_store_32(&decoder->endOfMusic, 0);
+
+            // Frames decoded from the old position are dropped and the request cleared together,
+            // the mixer only reads the ring locked. A newer request made during the seek is kept
+            ma_mutex_lock(&AUDIO.System.lock);
+            bool seekDone = (ma_atomic_compare_and_swap_32(&decoder->seekFrame, seekFrame, 0) == seekFrame);
+            if (seekDone)
+            {
+                ma_pcm_rb_reset(&decoder->ring);
+                decoder->framesPlayed = positionInFrames;
+            }
+            ma_mutex_unlock(&AUDIO.System.lock);
+
+            if (!seekDone) continue;
+        }
+
+        ma_uint32 framesToDecode = ma_pcm_rb_available_write(&decoder->ring);
+        if (framesToDecode > MUSIC_DECODE_CHUNK_FRAMES) framesToDecode = MUSIC_DECODE_CHUNK_FRAMES;
+
+        bool looping = (ma_atomic_load_32(&decoder->looping) != 0);
+        if (!looping)
+        {
+            unsigned int framesLeft = (decoder->framesDecoded < music.frameCount)? (music.frameCount - decoder->framesDecoded) : 0;
+
+            if (framesLeft == 0) ma_atomic_store_32(&decoder->endOfMusic, 1);
+            if (framesToDecode > framesLeft) framesToDecode = framesLeft;
+        }
+
+        // Ring full or music fully decoded
+        if (framesToDecode == 0)
+        {
+            ma_sleep(MUSIC_DECODE_SLEEP_MS);
+            continue;
+        }
+
+        void *framesOut = NULL;
+        if (ma_pcm_rb_acquire_write(&decoder->ring, &framesToDecode, &framesOut) != MA_SUCCESS) continue;
+
+        DecodeMusicFrames(music, framesOut, framesToDecode);
+        ma_pcm_rb_commit_write(&decoder->ring, framesToDecode);
+
+        decoder->framesDecoded += framesToDecode;
+        if (looping && (music.frameCount > 0)) decoder->framesDecoded %= music.frameCount;
+    }
+
+    return (ma_thread_result)0;
+}
+#endif
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
@@ -129,6 +129,25 @@
 
 // Allow custom memory allocators
 // NOTE: Require recompiling raylib sources
+// Define RL_MEMORY_HOOKS to route all raylib allocations through functions provided by
+// the application (i.e. for memory accounting), the application must implement all four
+#if defined(RL_MEMORY_HOOKS) && !defined(RL_MALLOC)
+    #include <stddef.h>                 // Required for: size_t
+    #if defined(__cplusplus)
+    extern "C" {
+    #endif
+    void *RLMemoryHookMalloc(size_t size);
+    void *RLMemoryHookCalloc(size_t count, size_t size);
+    void *RLMemoryHookRealloc(void *ptr, size_t size);
+    void RLMemoryHookFree(void *ptr);
+    #if defined(__cplusplus)
+    }
+    #endif
+    #define RL_MALLOC(sz)       RLMemoryHookMalloc(sz)
+    #define RL_CALLOC(n,sz)     RLMemoryHookCalloc(n,sz)
+    #define RL_REALLOC(ptr,sz)  RLMemoryHookRealloc(ptr,sz)
+    #define RL_FREE(ptr)        RLMemoryHookFree(ptr)
+#endif
 #ifndef RL_MALLOC
     #define RL_MALLOC(sz)       malloc(sz)
 #endif
@@ -312,6 +331,9 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Codepoint to glyph index lookup table (opaque, defined in rtext module)
+typedef struct rGlyphTable rGlyphTable;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -320,6 +342,7 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    rGlyphTable *lookup;    // Codepoint lookup table, built on font loading (NULL: linear search)
 } Font;
 
 // Camera, defines position/orientation in 3d space
@@ -955,6 +978,7 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSi
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, const char *text); // FileIO: Save text data
+typedef void (*HeadlessFrameCallback)(unsigned int frame);              // Headless: Frame presented (PLATFORM_HEADLESS)
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1088,6 +1112,7 @@ RLAPI int GetFPS(void);                                           // Get current
 RLAPI void SwapScreenBuffer(void);                                // Swap back buffer with front buffer (screen drawing)
 RLAPI void PollInputEvents(void);                                 // Register all input events
 RLAPI void WaitTime(double seconds);                              // Wait for some time (halt program execution)
+RLAPI void SetInputPollingManual(bool manual);                    // Set EndDrawing() to skip PollInputEvents(), user polls once per frame
 
 // Random values generation functions
 RLAPI void SetRandomSeed(unsigned int seed);                      // Set the seed for the random number generator
@@ -1175,6 +1200,24 @@ RLAPI void StartAutomationEventRecording(void);                   // Start recor
 RLAPI void StopAutomationEventRecording(void);                    // Stop recording automation events
 RLAPI void PlayAutomationEvent(AutomationEvent event);            // Play a recorded automation event
 
+#if defined(PLATFORM_HEADLESS)
+// Headless platform functionality (no window, software rendering, scripted input)
+RLAPI const unsigned char *GetHeadlessFrameBuffer(int *width, int *height); // Get last presented frame (RGBA8, top-left origin), call before next frame drawing
+RLAPI unsigned int GetHeadlessFrameCount(void);                   // Get number of frames presented since InitWindow()
+RLAPI void SetHeadlessFrameCallback(HeadlessFrameCallback callback); // Set callback run after every presented frame
+RLAPI void SetHeadlessTimeStep(double seconds);                   // Set virtual clock step per frame (WaitTime() does not sleep), 0 to use system clock
+RLAPI void SetHeadlessAutomationEventList(AutomationEventList *list); // Set automation events list to replay by frame, NULL to stop
+RLAPI void PushHeadlessKey(int key, bool down);                   // Push key down/up event, applied on next PollInputEvents()
+RLAPI void PushHeadlessChar(int codepoint);                       // Push character (unicode) event
+RLAPI void PushHeadlessMousePosition(float x, float y);           // Push mouse position event
+RLAPI void PushHeadlessMouseButton(int button, bool down);        // Push mouse button down/up event
+RLAPI void PushHeadlessMouseWheel(float x, float y);              // Push mouse wheel movement event
+RLAPI void PushHeadlessGamepadButton(int gamepad, int button, bool down); // Push gamepad button down/up event
+RLAPI void PushHeadlessGamepadAxis(int gamepad, int axis, float value); // Push gamepad axis movement event
+RLAPI void PushHeadlessDelay(int frames);                         // Push delay, following events are applied frames later
+RLAPI void PushHeadlessClose(void);                               // Push window close request
+#endif
+
 //------------------------------------------------------------------------------------
 // Input Handling Functions (Module: core)
 //------------------------------------------------------------------------------------
@@ -1476,6 +1519,7 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, const int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontFromAtlas(Image atlas, const GlyphInfo *glyphs, const Rectangle *recs, int glyphCount, int baseSize, int glyphPadding); // Load font from a prebuilt atlas image and glyph metrics (data is copied, glyph images are taken from atlas)
 RLAPI bool IsFontValid(Font font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount, int type, int *glyphCount); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
@@ -1648,6 +1692,8 @@ RLAPI void CloseAudioDevice(void);                                    // Close t
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
 RLAPI float GetMasterVolume(void);                                    // Get master volume (listener)
+RLAPI unsigned int GetAudioDeviceSampleRate(void);                    // Get audio device mixing sample rate, sounds are converted to it on load
+RLAPI unsigned int GetAudioDeviceChannels(void);                      // Get audio device mixing channels, sounds are converted to it on load
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
@@ -26,6 +26,8 @@
 *           - Linux DRM subsystem (KMS mode)
 *       > PLATFORM_ANDROID:
 *           - Android (ARM, ARM64)
+*       > PLATFORM_HEADLESS:
+*           - Any OS, no display required (software rendering, scripted input)
 *
 *   CONFIGURATION:
 *       #define SUPPORT_DEFAULT_FONT (default)
@@ -313,6 +315,8 @@ typedef struct CoreData {
 
     } Storage;
     struct {
+        bool manualPolling;                 // EndDrawing() leaves PollInputEvents() to the user
+
         struct {
             int exitKey;                    // Default exit key
             char currentKeyState[MAX_KEYBOARD_KEYS];        // Registers current frame key state
@@ -563,6 +567,8 @@ const char *TextFormat(const char *text, ...); // Formatting of text with variab
     #include "platforms/rcore_drm.c"
 #elif defined(PLATFORM_ANDROID)
     #include "platforms/rcore_android.c"
+#elif defined(PLATFORM_HEADLESS)
+    #include "platforms/rcore_headless.c"
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -637,6 +643,8 @@ void InitWindow(int width, int height, const char *title)
     TRACELOG(LOG_INFO, "Platform backend: NATIVE DRM");
 #elif defined(PLATFORM_ANDROID)
     TRACELOG(LOG_INFO, "Platform backend: ANDROID");
+#elif defined(PLATFORM_HEADLESS)
+    TRACELOG(LOG_INFO, "Platform backend: HEADLESS (software rendering)");
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -985,7 +993,7 @@ void EndDrawing(void)
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
     }
 
-    PollInputEvents();      // Poll user events (before next frame update)
+    if (!CORE.Input.manualPolling) PollInputEvents();      // Poll user events (before next frame update)
 #endif
 
 #if defined(SUPPORT_SCREEN_CAPTURE)
@@ -1684,6 +1692,14 @@ void SetTargetFPS(int fps)
     TRACELOG(LOG_INFO, "TIMER: Target time per frame: %02.03f milliseconds", (float)CORE.Time.target*1000.0f);
 }
 
+// Set input events polling by EndDrawing() (default), disable to call PollInputEvents() manually
+// NOTE: Polling right before the next update, after the frame wait, reduces input latency
+// Input state is sampled once per PollInputEvents() call, it must be called exactly once per frame
+void SetInputPollingManual(bool manual)
+{
+    CORE.Input.manualPolling = manual;
+}
+
 // Get current FPS
 // NOTE: We calculate an average framerate
 int GetFPS(void)
@@ -1750,6 +1766,11 @@ void WaitTime(double seconds)
 {
     if (seconds < 0) return;    // Security check
 
+#if defined(PLATFORM_HEADLESS)
+    // Virtual clock just moves forward, nothing to wait for
+    if (HeadlessWaitTime(seconds)) return;
+#endif
+
 #if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
     double destinationTime = GetTime() + seconds;
 #endif
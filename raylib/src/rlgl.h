@@ -777,7 +777,9 @@ RLAPI bool rlFramebufferComplete(unsigned int id);                        // Ver
 RLAPI void rlUnloadFramebuffer(unsigned int id);                          // Delete framebuffer from GPU
 #if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
 RLAPI void rlCopyFramebuffer(int x, int y, int width, int height, int format, void *pixels); // Copy framebuffer pixel data to internal buffer
+RLAPI int rlCopyFramebufferDamage(int format, int pitch, void *pixels, int *rects, int maxRects); // Copy framebuffer regions changed since last call, returns rects count (x, y, w, h)
 RLAPI void rlResizeFramebuffer(int width, int height);                    // Resize internal framebuffer
+RLAPI void rlFlushFramebuffer(void);                                      // Finish rendering pending framebuffer commands
 #endif
 
 // Shaders management
@@ -3757,11 +3759,27 @@ void rlCopyFramebuffer(int x, int y, int width, int height, int format, void* pi
     swCopyFramebuffer(x, y, width, height, glFormat, glType, pixels);
 }
 
+// Copy framebuffer regions changed since last call into a full size buffer
+// NOTE: Rectangles are written as (x, y, width, height), more than maxRects are merged into one
+int rlCopyFramebufferDamage(int format, int pitch, void *pixels, int *rects, int maxRects)
+{
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType); // Get OpenGL texture format
+    return swCopyFramebufferDamage(glFormat, glType, pitch, pixels, rects, maxRects);
+}
+
 // Resize internal framebuffer
 void rlResizeFramebuffer(int width, int height)
 {
     swResizeFramebuffer(width, height);
 }
+
+// Finish rendering pending framebuffer commands
+// NOTE: Required once per frame with deferred rasterization (SW_DAMAGE_TRACKING) when the frame is not read
+void rlFlushFramebuffer(void)
+{
+    swFlush();
+}
 #endif
 
 // Read screen pixel data (color buffer)
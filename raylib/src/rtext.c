@@ -118,11 +118,23 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef GLYPH_TABLE_DIRECT_SIZE
+    #define GLYPH_TABLE_DIRECT_SIZE              256        // Codepoints looked up by direct indexing (ASCII + Latin-1)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Codepoint to glyph index lookup table, built once per font on loading
+// NOTE: Direct-mapped table for ASCII/Latin-1, open addressing hash table (linear probing)
+// for the rest, so GetGlyphIndex() does not scale with the font glyph count
+struct rGlyphTable {
+    int fallbackIndex;                      // Glyph index returned for missing codepoints ('?' or 0)
+    int direct[GLYPH_TABLE_DIRECT_SIZE];    // Glyph index per codepoint, -1 if not in font
+    unsigned int hashMask;                  // Hash table capacity - 1 (capacity is a power of two)
+    int *hashCodepoints;                    // Hash table keys, 0 marks an empty slot
+    int *hashIndices;                       // Hash table values (glyph index)
+};
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -149,6 +161,8 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static rGlyphTable *LoadGlyphTable(const GlyphInfo *glyphs, int glyphCount);   // Build codepoint lookup table for a glyph set
+static void UnloadGlyphTable(rGlyphTable *table);                               // Unload codepoint lookup table
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
@@ -323,6 +337,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.lookup = LoadGlyphTable(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -334,9 +349,11 @@ extern void UnloadFontDefault(void)
     if (isGpuReady) UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    UnloadGlyphTable(defaultFont.lookup);
     defaultFont.glyphCount = 0;
     defaultFont.glyphs = NULL;
     defaultFont.recs = NULL;
+    defaultFont.lookup = NULL;
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -544,6 +561,38 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.lookup = LoadGlyphTable(font.glyphs, font.glyphCount);   // NOTE: Replaces the default font table copied on init
+
+    return font;
+}
+
+// Load font from a prebuilt atlas image and glyph metrics, i.e. an atlas cached on disk
+// NOTE: Input data is copied, glyphs[i].image is ignored and regenerated from the atlas
+Font LoadFontFromAtlas(Image atlas, const GlyphInfo *glyphs, const Rectangle *recs, int glyphCount, int baseSize, int glyphPadding)
+{
+    Font font = { 0 };
+
+    if ((atlas.data == NULL) || (glyphs == NULL) || (recs == NULL) || (glyphCount <= 0)) return font;
+
+    font.baseSize = baseSize;
+    font.glyphCount = glyphCount;
+    font.glyphPadding = glyphPadding;
+    font.glyphs = (GlyphInfo *)RL_MALLOC(glyphCount*sizeof(GlyphInfo));
+    font.recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        font.glyphs[i] = glyphs[i];
+        font.recs[i] = recs[i];
+
+        // Glyph images are required to be used on ImageDrawText()
+        font.glyphs[i].image = ImageFromImage(atlas, recs[i]);
+    }
+
+    if (isGpuReady) font.texture = LoadTextureFromImage(atlas);
+    font.lookup = LoadGlyphTable(font.glyphs, font.glyphCount);
+
+    TRACELOG(LOG_INFO, "FONT: Data loaded successfully from atlas (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
 
     return font;
 }
@@ -596,6 +645,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
         UnloadImage(atlas);
 
+        font.lookup = LoadGlyphTable(font.glyphs, font.glyphCount);
+
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
     }
     else font = GetFontDefault();
@@ -1010,6 +1061,7 @@ void UnloadFont(Font font)
         UnloadFontData(font.glyphs, font.glyphCount);
         if (isGpuReady) UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        UnloadGlyphTable(font.lookup);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -1398,6 +1450,28 @@ int GetGlyphIndex(Font font, int codepoint)
     int index = 0;
     if (!IsFontValid(font)) return index;
 
+    // Fonts loaded by raylib carry a precomputed lookup table
+    if (font.lookup != NULL)
+    {
+        if ((unsigned int)codepoint < GLYPH_TABLE_DIRECT_SIZE) index = font.lookup->direct[codepoint];
+        else if (font.lookup->hashMask > 0)
+        {
+            index = -1;
+            unsigned int hash = (unsigned int)codepoint*0x9e3779b1u;
+            for (unsigned int slot = (hash ^ (hash >> 16)) & font.lookup->hashMask; font.lookup->hashCodepoints[slot] != 0; slot = (slot + 1) & font.lookup->hashMask)
+            {
+                if (font.lookup->hashCodepoints[slot] == codepoint)
+                {
+                    index = font.lookup->hashIndices[slot];
+                    break;
+                }
+            }
+        }
+        else index = -1;
+
+        return (index >= 0)? index : font.lookup->fallbackIndex;
+    }
+
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
@@ -2485,6 +2559,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(fullFont);
     UnloadFileText(fileText);
 
+    font.lookup = LoadGlyphTable(font.glyphs, font.glyphCount);
+
     if (isGpuReady && (font.texture.id == 0))
     {
         UnloadFont(font);
@@ -2749,4 +2825,65 @@ static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, c
 }
 #endif      // SUPPORT_FILEFORMAT_BDF
 
+// Build codepoint lookup table for a glyph set
+// NOTE: Matches the linear search it replaces: first glyph wins on duplicated codepoints,
+// missing codepoints map to the fallback glyph '?' (or glyph 0 if the font has none)
+static rGlyphTable *LoadGlyphTable(const GlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    // Hash table sized to at least twice the glyphs outside the direct range
+    int hashedCount = 0;
+    for (int i = 0; i < glyphCount; i++) if (glyphs[i].value >= GLYPH_TABLE_DIRECT_SIZE) hashedCount++;
+
+    unsigned int capacity = 0;
+    if (hashedCount > 0)
+    {
+        capacity = 16;
+        while (capacity < 2*(unsigned int)hashedCount) capacity *= 2;
+    }
+
+    // Single allocation: table header followed by hash keys and values
+    rGlyphTable *table = (rGlyphTable *)RL_MALLOC(sizeof(rGlyphTable) + 2*capacity*sizeof(int));
+    if (table == NULL) return NULL;
+
+    table->fallbackIndex = 0;
+    for (int i = 0; i < GLYPH_TABLE_DIRECT_SIZE; i++) table->direct[i] = -1;
+    table->hashMask = (capacity > 0)? capacity - 1 : 0;
+    table->hashCodepoints = (int *)(table + 1);
+    table->hashIndices = table->hashCodepoints + capacity;
+    for (unsigned int i = 0; i < capacity; i++) table->hashCodepoints[i] = 0;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int codepoint = glyphs[i].value;
+        if (codepoint == 63) table->fallbackIndex = i;
+
+        if ((codepoint >= 0) && (codepoint < GLYPH_TABLE_DIRECT_SIZE))
+        {
+            if (table->direct[codepoint] < 0) table->direct[codepoint] = i;
+        }
+        else if (codepoint >= GLYPH_TABLE_DIRECT_SIZE)
+        {
+            unsigned int hash = (unsigned int)codepoint*0x9e3779b1u;
+            unsigned int slot = (hash ^ (hash >> 16)) & table->hashMask;
+            while ((table->hashCodepoints[slot] != 0) && (table->hashCodepoints[slot] != codepoint)) slot = (slot + 1) & table->hashMask;
+
+            if (table->hashCodepoints[slot] == 0)
+            {
+                table->hashCodepoints[slot] = codepoint;
+                table->hashIndices[slot] = i;
+            }
+        }
+    }
+
+    return table;
+}
+
+// Unload codepoint lookup table
+static void UnloadGlyphTable(rGlyphTable *table)
+{
+    RL_FREE(table);
+}
+
 #endif      // SUPPORT_MODULE_RTEXT
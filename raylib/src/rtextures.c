@@ -242,10 +242,94 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef IMAGE_PROCESSING_THREADS
+    #define IMAGE_PROCESSING_THREADS        1       // Threads splitting large image operations by rows, 0: one per CPU core
+#endif
+#ifndef IMAGE_PROCESSING_MAX_THREADS
+    #define IMAGE_PROCESSING_MAX_THREADS   16       // Maximum threads used by one image operation
+#endif
+#ifndef IMAGE_PROCESSING_MIN_PIXELS
+    #define IMAGE_PROCESSING_MIN_PIXELS 65536       // Operations on fewer pixels stay on the calling thread
+#endif
+
+#if (IMAGE_PROCESSING_THREADS != 1)
+    #if defined(_WIN32)
+        // Win32 threading, declared here to avoid including windows.h (its names clash with raylib)
+        struct _SECURITY_ATTRIBUTES;
+        #if defined(_WIN64)
+            typedef unsigned long long rl_win32_size_t;
+        #else
+            typedef unsigned long rl_win32_size_t;
+        #endif
+        __declspec(dllimport) void *__stdcall CreateThread(struct _SECURITY_ATTRIBUTES *attributes, rl_win32_size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+    #else
+        #include <pthread.h>        // Required for: pthread_create(), pthread_join()
+        #include <unistd.h>         // Required for: sysconf()
+    #endif
+#endif
+
+// SIMD paths for 8 bit RGBA image operations: ImageDraw(), ImageColorTint()
+#if !defined(__TINYC__) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    #include <emmintrin.h>          // Required for: SSE2 intrinsics
+    #define IMAGE_SIMD_SSE2
+#elif !defined(__TINYC__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #include <arm_neon.h>           // Required for: NEON intrinsics
+    #define IMAGE_SIMD_NEON
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image operation applied to a range of rows, see ProcessImageRows()
+typedef void (*ImageRowsFunc)(void *data, int rowStart, int rowEnd);
+
+// Rows range run by one thread
+typedef struct ImageRowsTask {
+    ImageRowsFunc func;
+    void *data;
+    int rowStart;
+    int rowEnd;
+} ImageRowsTask;
+
+// Rows copy between two images with the same pixel format [ImageFromImage(), ImageDraw()]
+typedef struct ImageCopyRows {
+    const unsigned char *src;
+    unsigned char *dst;
+    int srcStride;
+    int dstStride;
+    int rowSize;
+} ImageCopyRows;
+
+// Tinted alpha blending of 8 bit RGBA rows [ImageDraw()]
+typedef struct ImageBlendRows {
+    const unsigned char *src;
+    unsigned char *dst;
+    int srcStride;
+    int dstStride;
+    int width;
+    Color tint;
+} ImageBlendRows;
+
+// Nearest-neighbor scaling of 8 bit RGBA pixels [ImageResizeNN()]
+typedef struct ImageScaleRows {
+    const Color *src;
+    Color *dst;
+    int srcWidth;
+    int dstWidth;
+    int xRatio;
+    int yRatio;
+} ImageScaleRows;
+
+// Per-pixel operation on 8 bit RGBA pixels [ImageColorTint(), ImageColorReplace()]
+typedef struct ImageColorRows {
+    Color *pixels;
+    int width;
+    Color color;
+    Color replace;
+} ImageColorRows;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -264,6 +348,18 @@ static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
 
+static void ProcessImageRows(ImageRowsFunc func, void *data, int rowCount, int pixelCount);  // Run an operation over image rows, split across threads if large enough
+static int GetImageThreadCount(int pixelCount);             // Get threads count to split an operation on pixelCount pixels
+static void CopyImageRows(void *data, int rowStart, int rowEnd);            // ImageCopyRows operation
+static void BlendImageRows(void *data, int rowStart, int rowEnd);           // ImageBlendRows operation
+static void ScaleImageRowsNN(void *data, int rowStart, int rowEnd);         // ImageScaleRows operation
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void TintImageRows(void *data, int rowStart, int rowEnd);            // ImageColorRows operation: multiply by color
+static void ReplaceImageRows(void *data, int rowStart, int rowEnd);         // ImageColorRows operation: replace color
+#endif
+static void ResizeImageSplits(void *data, int splitStart, int splitEnd);    // Step of ResizeImageData()
+static void ResizeImageData(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels);  // Resize 8 bit channels data (stb_image_resize2)
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -1193,10 +1289,15 @@ Image ImageFromImage(Image image, Rectangle rec)
     result.format = image.format;
     result.mipmaps = 1;
 
-    for (int y = 0; y < (int)rec.height; y++)
-    {
-        memcpy(((unsigned char *)result.data) + y*(int)rec.width*bytesPerPixel, ((unsigned char *)image.data) + ((y + (int)rec.y)*image.width + (int)rec.x)*bytesPerPixel, (int)rec.width*bytesPerPixel);
-    }
+    ImageCopyRows rows = {
+        .src = (unsigned char *)image.data + ((int)rec.y*image.width + (int)rec.x)*bytesPerPixel,
+        .dst = (unsigned char *)result.data,
+        .srcStride = image.width*bytesPerPixel,
+        .dstStride = (int)rec.width*bytesPerPixel,
+        .rowSize = (int)rec.width*bytesPerPixel
+    };
+
+    ProcessImageRows(CopyImageRows, &rows, (int)rec.height, (int)rec.width*(int)rec.height);
 
     return result;
 }
@@ -1716,27 +1817,27 @@ void ImageResizeNN(Image *image, int newWidth, int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    // Fast path: 32bit RGBA image is scaled directly, no pixels copy required
+    bool directPixels = (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    Color *pixels = directPixels? (Color *)image->data : LoadImageColors(*image);
     Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
     // EDIT: added +1 to account for an early rounding problem
-    int xRatio = (int)((image->width << 16)/newWidth) + 1;
-    int yRatio = (int)((image->height << 16)/newHeight) + 1;
-
-    int x2, y2;
-    for (int y = 0; y < newHeight; y++)
-    {
-        for (int x = 0; x < newWidth; x++)
-        {
-            x2 = ((x*xRatio) >> 16);
-            y2 = ((y*yRatio) >> 16);
+    ImageScaleRows rows = {
+        .src = pixels,
+        .dst = output,
+        .srcWidth = image->width,
+        .dstWidth = newWidth,
+        .xRatio = (int)((image->width << 16)/newWidth) + 1,
+        .yRatio = (int)((image->height << 16)/newHeight) + 1
+    };
 
-            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
-        }
-    }
+    ProcessImageRows(ScaleImageRowsNN, &rows, newHeight, newWidth*newHeight);
 
     int format = image->format;
 
+    if (!directPixels) UnloadImageColors(pixels);
     RL_FREE(image->data);
 
     image->data = output;
@@ -1745,8 +1846,6 @@ void ImageResizeNN(Image *image, int newWidth, int newHeight)
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
     ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
-
-    UnloadImageColors(pixels);
 }
 
 // Resize and image to new size
@@ -1768,14 +1867,8 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+        // NOTE: Channels count matches the stb_image_resize2 pixel layout (1, 2, RGB, RGBA)
+        ResizeImageData((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, bytesPerPixel);
 
         RL_FREE(image->data);
         image->data = output;
@@ -1789,7 +1882,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
         // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        ResizeImageData((unsigned char *)pixels, image->width, image->height, (unsigned char *)output, newWidth, newHeight, 4);
 
         int format = image->format;
 
@@ -2749,21 +2842,19 @@ void ImageColorTint(Image *image, Color color)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
+    // Fast path: 32bit RGBA image is tinted in place
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
     {
-        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
-        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
-        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
-        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
-
-        pixels[i].r = r;
-        pixels[i].g = g;
-        pixels[i].b = b;
-        pixels[i].a = a;
+        ImageColorRows rows = { .pixels = (Color *)image->data, .width = image->width, .color = color };
+        ProcessImageRows(TintImageRows, &rows, image->height, image->width*image->height);
+        return;
     }
 
+    Color *pixels = LoadImageColors(*image);
+
+    ImageColorRows rows = { .pixels = pixels, .width = image->width, .color = color };
+    ProcessImageRows(TintImageRows, &rows, image->height, image->width*image->height);
+
     int format = image->format;
     RL_FREE(image->data);
 
@@ -2905,22 +2996,19 @@ void ImageColorReplace(Image *image, Color color, Color replace)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
+    // Fast path: 32bit RGBA image is replaced in place
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
     {
-        if ((pixels[i].r == color.r) &&
-            (pixels[i].g == color.g) &&
-            (pixels[i].b == color.b) &&
-            (pixels[i].a == color.a))
-        {
-            pixels[i].r = replace.r;
-            pixels[i].g = replace.g;
-            pixels[i].b = replace.b;
-            pixels[i].a = replace.a;
-        }
+        ImageColorRows rows = { .pixels = (Color *)image->data, .width = image->width, .color = color, .replace = replace };
+        ProcessImageRows(ReplaceImageRows, &rows, image->height, image->width*image->height);
+        return;
     }
 
+    Color *pixels = LoadImageColors(*image);
+
+    ImageColorRows rows = { .pixels = pixels, .width = image->width, .color = color, .replace = replace };
+    ProcessImageRows(ReplaceImageRows, &rows, image->height, image->width*image->height);
+
     int format = image->format;
     RL_FREE(image->data);
 
@@ -3996,6 +4084,7 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
         //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
+        //    [x] Consider fast path: 32bit RGBA blending by groups of 4 pixels (SIMD), rows split across threads
         //    [ ] Support f32bit channels drawing
 
         // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and PIXELFORMAT_UNCOMPRESSED_R1616B16A16
@@ -4023,33 +4112,55 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
         unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
 
-        for (int y = 0; y < (int)srcRec.height; y++)
-        {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
+        // Fast path: Rows processed in parallel, source and destination must not overlap
+        bool rowsPath = (srcPtr->data != dst->data) && (srcPtr->format == dst->format) &&
+            (!blendRequired || (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+        int drawWidth = (int)srcRec.width;
+        int drawHeight = (int)srcRec.height;
 
-            // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+        if (rowsPath && (drawWidth > 0) && (drawHeight > 0))
+        {
+            if (!blendRequired)
+            {
+                ImageCopyRows rows = { pSrcBase, pDstBase, strideSrc, strideDst, drawWidth*bytesPerPixelSrc };
+                ProcessImageRows(CopyImageRows, &rows, drawHeight, drawWidth*drawHeight);
+            }
             else
             {
-                for (int x = 0; x < (int)srcRec.width; x++)
+                ImageBlendRows rows = { pSrcBase, pDstBase, strideSrc, strideDst, drawWidth, tint };
+                ProcessImageRows(BlendImageRows, &rows, drawHeight, drawWidth*drawHeight);
+            }
+        }
+        else
+        {
+            for (int y = 0; y < (int)srcRec.height; y++)
+            {
+                unsigned char *pSrc = pSrcBase;
+                unsigned char *pDst = pDstBase;
+
+                // Fast path: Avoid moving pixel by pixel if no blend required and same format
+                if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+                else
                 {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
-                    colDst = GetPixelColor(pDst, dst->format);
+                    for (int x = 0; x < (int)srcRec.width; x++)
+                    {
+                        colSrc = GetPixelColor(pSrc, srcPtr->format);
+                        colDst = GetPixelColor(pDst, dst->format);
 
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
+                        // Fast path: Avoid blend if source has no alpha to blend
+                        if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
+                        else blend = colSrc;
 
-                    SetPixelColor(pDst, blend, dst->format);
+                        SetPixelColor(pDst, blend, dst->format);
 
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
+                        pDst += bytesPerPixelDst;
+                        pSrc += bytesPerPixelSrc;
+                    }
                 }
-            }
 
-            pSrcBase += strideSrc;
-            pDstBase += strideDst;
+                pSrcBase += strideSrc;
+                pDstBase += strideDst;
+            }
         }
 
         if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
@@ -5587,4 +5698,361 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+// Get threads count to split an operation on pixelCount pixels
+static int GetImageThreadCount(int pixelCount)
+{
+    int threadCount = 1;
+
+#if (IMAGE_PROCESSING_THREADS != 1)
+    if (pixelCount >= IMAGE_PROCESSING_MIN_PIXELS)
+    {
+        threadCount = IMAGE_PROCESSING_THREADS;
+
+        if (threadCount <= 0)
+        {
+            static int processorCount = 0;
+
+            if (processorCount == 0)
+            {
+            #if defined(_WIN32)
+                processorCount = (int)GetActiveProcessorCount(0xFFFF);  // ALL_PROCESSOR_GROUPS
+            #elif defined(_SC_NPROCESSORS_ONLN)
+                processorCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+            #endif
+                if (processorCount < 1) processorCount = 1;
+            }
+
+            threadCount = processorCount;
+        }
+
+        if (threadCount > IMAGE_PROCESSING_MAX_THREADS) threadCount = IMAGE_PROCESSING_MAX_THREADS;
+    }
+#else
+    (void)pixelCount;
+#endif
+
+    return threadCount;
+}
+
+#if (IMAGE_PROCESSING_THREADS != 1)
+// Thread entry point for a rows range of ProcessImageRows()
+#if defined(_WIN32)
+static unsigned long __stdcall ImageRowsThread(void *param)
+#else
+static void *ImageRowsThread(void *param)
+#endif
+{
+    ImageRowsTask *task = (ImageRowsTask *)param;
+    task->func(task->data, task->rowStart, task->rowEnd);
+
+    return 0;
+}
+#endif
+
+// Run an operation over image rows, split across threads if large enough
+// NOTE: Threads are created per call, the operation must be large enough to pay for them,
+// the calling thread runs the first rows range and any range a thread failed to start for
+static void ProcessImageRows(ImageRowsFunc func, void *data, int rowCount, int pixelCount)
+{
+    int threadCount = GetImageThreadCount(pixelCount);
+    if (threadCount > rowCount) threadCount = rowCount;
+
+#if (IMAGE_PROCESSING_THREADS != 1)
+    if (threadCount > 1)
+    {
+        ImageRowsTask tasks[IMAGE_PROCESSING_MAX_THREADS] = { 0 };
+        bool started[IMAGE_PROCESSING_MAX_THREADS] = { 0 };
+    #if defined(_WIN32)
+        void *threads[IMAGE_PROCESSING_MAX_THREADS] = { 0 };
+    #else
+        pthread_t threads[IMAGE_PROCESSING_MAX_THREADS];
+    #endif
+
+        for (int i = 0; i < threadCount; i++)
+        {
+            tasks[i] = (ImageRowsTask){ func, data, rowCount*i/threadCount, rowCount*(i + 1)/threadCount };
+        }
+
+        for (int i = 1; i < threadCount; i++)
+        {
+        #if defined(_WIN32)
+            threads[i] = CreateThread(NULL, 0, ImageRowsThread, &tasks[i], 0, NULL);
+            started[i] = (threads[i] != NULL);
+        #else
+            started[i] = (pthread_create(&threads[i], NULL, ImageRowsThread, &tasks[i]) == 0);
+        #endif
+        }
+
+        func(data, tasks[0].rowStart, tasks[0].rowEnd);
+
+        for (int i = 1; i < threadCount; i++)
+        {
+            if (started[i])
+            {
+            #if defined(_WIN32)
+                WaitForSingleObject(threads[i], 0xFFFFFFFF);    // INFINITE
+                CloseHandle(threads[i]);
+            #else
+                pthread_join(threads[i], NULL);
+            #endif
+            }
+            else func(data, tasks[i].rowStart, tasks[i].rowEnd);
+        }
+
+        return;
+    }
+#endif
+
+    func(data, 0, rowCount);
+}
+
+#if defined(IMAGE_SIMD_SSE2)
+typedef __m128i ImagePixels4;       // 4 pixels RGBA 8 bit
+typedef __m128i ImageTint4;         // Tint color as 16 bit lanes, two copies
+
+static inline ImagePixels4 LoadPixels4(const unsigned char *src) { return _mm_loadu_si128((const __m128i *)src); }
+static inline void StorePixels4(unsigned char *dst, ImagePixels4 pixels) { _mm_storeu_si128((__m128i *)dst, pixels); }
+static inline ImageTint4 LoadTint4(Color tint) { return _mm_setr_epi16(tint.r, tint.g, tint.b, tint.a, tint.r, tint.g, tint.b, tint.a); }
+
+// Multiply pixels channels by tint: channel*tint/255 (ColorTint) or channel*(tint + 1)/256 (ColorAlphaBlend)
+// NOTE: Products fit 16 bit unsigned lanes, (p + 1 + p/256)/256 equals p/255 for any p <= 255*255
+static inline ImagePixels4 TintPixels4(ImagePixels4 pixels, ImageTint4 tint, bool divide255)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_unpacklo_epi8(pixels, zero);
+    __m128i hi = _mm_unpackhi_epi8(pixels, zero);
+    __m128i productLo = _mm_mullo_epi16(lo, tint);
+    __m128i productHi = _mm_mullo_epi16(hi, tint);
+
+    if (divide255)
+    {
+        __m128i one = _mm_set1_epi16(1);
+        productLo = _mm_add_epi16(_mm_add_epi16(productLo, one), _mm_srli_epi16(productLo, 8));
+        productHi = _mm_add_epi16(_mm_add_epi16(productHi, one), _mm_srli_epi16(productHi, 8));
+    }
+    else
+    {
+        productLo = _mm_add_epi16(productLo, lo);
+        productHi = _mm_add_epi16(productHi, hi);
+    }
+
+    return _mm_packus_epi16(_mm_srli_epi16(productLo, 8), _mm_srli_epi16(productHi, 8));
+}
+
+// Get bit mask of pixels with the given alpha, bit i for pixel i
+static inline int AlphaMaskPixels4(ImagePixels4 pixels, unsigned char alpha)
+{
+    __m128i alphas = _mm_and_si128(pixels, _mm_set1_epi32((int)0xff000000));
+    __m128i equal = _mm_cmpeq_epi32(alphas, _mm_set1_epi32((int)((unsigned int)alpha << 24)));
+
+    return _mm_movemask_ps(_mm_castsi128_ps(equal));
+}
+#elif defined(IMAGE_SIMD_NEON)
+typedef uint8x16_t ImagePixels4;    // 4 pixels RGBA 8 bit
+typedef uint8x8_t ImageTint4;       // Tint color, two copies
+
+static inline ImagePixels4 LoadPixels4(const unsigned char *src) { return vld1q_u8(src); }
+static inline void StorePixels4(unsigned char *dst, ImagePixels4 pixels) { vst1q_u8(dst, pixels); }
+static inline ImageTint4 LoadTint4(Color tint)
+{
+    const unsigned char channels[8] = { tint.r, tint.g, tint.b, tint.a, tint.r, tint.g, tint.b, tint.a };
+    return vld1_u8(channels);
+}
+
+// Multiply pixels channels by tint: channel*tint/255 (ColorTint) or channel*(tint + 1)/256 (ColorAlphaBlend)
+// NOTE: (p + 1 + p/256)/256 equals p/255 for any p <= 255*255
+static inline ImagePixels4 TintPixels4(ImagePixels4 pixels, ImageTint4 tint, bool divide255)
+{
+    uint16x8_t productLo = vmull_u8(vget_low_u8(pixels), tint);
+    uint16x8_t productHi = vmull_u8(vget_high_u8(pixels), tint);
+
+    if (divide255)
+    {
+        uint16x8_t one = vdupq_n_u16(1);
+        productLo = vaddq_u16(vsraq_n_u16(productLo, productLo, 8), one);
+        productHi = vaddq_u16(vsraq_n_u16(productHi, productHi, 8), one);
+    }
+    else
+    {
+        productLo = vaddw_u8(productLo, vget_low_u8(pixels));
+        productHi = vaddw_u8(productHi, vget_high_u8(pixels));
+    }
+
+    return vcombine_u8(vshrn_n_u16(productLo, 8), vshrn_n_u16(productHi, 8));
+}
+
+// Get bit mask of pixels with the given alpha, bit i for pixel i
+static inline int AlphaMaskPixels4(ImagePixels4 pixels, unsigned char alpha)
+{
+    static const unsigned int bits[4] = { 1, 2, 4, 8 };
+    uint32x4_t alphas = vandq_u32(vreinterpretq_u32_u8(pixels), vdupq_n_u32(0xff000000));
+    uint32x4_t equal = vandq_u32(vceqq_u32(alphas, vdupq_n_u32((unsigned int)alpha << 24)), vld1q_u32(bits));
+    uint32x2_t sum = vadd_u32(vget_low_u32(equal), vget_high_u32(equal));
+
+    return (int)vget_lane_u32(vpadd_u32(sum, sum), 0);
+}
+#endif
+
+// ImageCopyRows operation
+static void CopyImageRows(void *data, int rowStart, int rowEnd)
+{
+    const ImageCopyRows *rows = (const ImageCopyRows *)data;
+
+    for (int y = rowStart; y < rowEnd; y++) memcpy(rows->dst + y*rows->dstStride, rows->src + y*rows->srcStride, rows->rowSize);
+}
+
+// Blend a tinted source pixel into a destination pixel, both RGBA 8 bit
+// NOTE: Same result as ColorAlphaBlend(), the source is already tinted
+static inline void BlendPixelRGBA8(unsigned char *dst, const unsigned char *src)
+{
+    if (src[3] == 0) return;
+    else if (src[3] == 255) memcpy(dst, src, 4);
+    else
+    {
+        Color blend = ColorAlphaBlend((Color){ dst[0], dst[1], dst[2], dst[3] }, (Color){ src[0], src[1], src[2], src[3] }, WHITE);
+        memcpy(dst, &blend, 4);
+    }
+}
+
+// ImageBlendRows operation
+// NOTE: Groups of 4 fully opaque or fully transparent pixels are stored or skipped as a whole
+static void BlendImageRows(void *data, int rowStart, int rowEnd)
+{
+    const ImageBlendRows *rows = (const ImageBlendRows *)data;
+    Color tint = rows->tint;
+    bool tinted = ((tint.r != 255) || (tint.g != 255) || (tint.b != 255) || (tint.a != 255));
+
+#if defined(IMAGE_SIMD_SSE2) || defined(IMAGE_SIMD_NEON)
+    ImageTint4 tint4 = LoadTint4(tint);
+#endif
+
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        const unsigned char *src = rows->src + y*rows->srcStride;
+        unsigned char *dst = rows->dst + y*rows->dstStride;
+        int x = 0;
+
+#if defined(IMAGE_SIMD_SSE2) || defined(IMAGE_SIMD_NEON)
+        for (; x + 4 <= rows->width; x += 4)
+        {
+            ImagePixels4 pixels = LoadPixels4(src + x*4);
+            if (tinted) pixels = TintPixels4(pixels, tint4, false);
+
+            if (AlphaMaskPixels4(pixels, 255) == 0xf) StorePixels4(dst + x*4, pixels);
+            else if (AlphaMaskPixels4(pixels, 0) != 0xf)
+            {
+                unsigned char blend[16];
+                StorePixels4(blend, pixels);
+
+                for (int i = 0; i < 4; i++) BlendPixelRGBA8(dst + (x + i)*4, blend + i*4);
+            }
+        }
+#endif
+        for (; x < rows->width; x++)
+        {
+            unsigned char pixel[4] = { src[x*4], src[x*4 + 1], src[x*4 + 2], src[x*4 + 3] };
+
+            if (tinted)
+            {
+                pixel[0] = (unsigned char)(((unsigned int)pixel[0]*((unsigned int)tint.r + 1)) >> 8);
+                pixel[1] = (unsigned char)(((unsigned int)pixel[1]*((unsigned int)tint.g + 1)) >> 8);
+                pixel[2] = (unsigned char)(((unsigned int)pixel[2]*((unsigned int)tint.b + 1)) >> 8);
+                pixel[3] = (unsigned char)(((unsigned int)pixel[3]*((unsigned int)tint.a + 1)) >> 8);
+            }
+
+            BlendPixelRGBA8(dst + x*4, pixel);
+        }
+    }
+}
+
+// ImageScaleRows operation
+static void ScaleImageRowsNN(void *data, int rowStart, int rowEnd)
+{
+    const ImageScaleRows *rows = (const ImageScaleRows *)data;
+
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        const Color *src = rows->src + ((y*rows->yRatio) >> 16)*rows->srcWidth;
+        Color *dst = rows->dst + y*rows->dstWidth;
+
+        for (int x = 0; x < rows->dstWidth; x++) dst[x] = src[(x*rows->xRatio) >> 16];
+    }
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// ImageColorRows operation: multiply by color
+static void TintImageRows(void *data, int rowStart, int rowEnd)
+{
+    const ImageColorRows *rows = (const ImageColorRows *)data;
+    Color color = rows->color;
+
+#if defined(IMAGE_SIMD_SSE2) || defined(IMAGE_SIMD_NEON)
+    ImageTint4 tint4 = LoadTint4(color);
+#endif
+
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        Color *pixels = rows->pixels + y*rows->width;
+        int x = 0;
+
+#if defined(IMAGE_SIMD_SSE2) || defined(IMAGE_SIMD_NEON)
+        for (; x + 4 <= rows->width; x += 4)
+        {
+            StorePixels4((unsigned char *)(pixels + x), TintPixels4(LoadPixels4((const unsigned char *)(pixels + x)), tint4, true));
+        }
+#endif
+        for (; x < rows->width; x++)
+        {
+            pixels[x].r = (unsigned char)(((int)pixels[x].r*(int)color.r)/255);
+            pixels[x].g = (unsigned char)(((int)pixels[x].g*(int)color.g)/255);
+            pixels[x].b = (unsigned char)(((int)pixels[x].b*(int)color.b)/255);
+            pixels[x].a = (unsigned char)(((int)pixels[x].a*(int)color.a)/255);
+        }
+    }
+}
+
+// ImageColorRows operation: replace color
+static void ReplaceImageRows(void *data, int rowStart, int rowEnd)
+{
+    const ImageColorRows *rows = (const ImageColorRows *)data;
+    unsigned int color = 0;
+    unsigned int replace = 0;
+    memcpy(&color, &rows->color, 4);
+    memcpy(&replace, &rows->replace, 4);
+
+    // NOTE: Color is 4 bytes with no padding, pixels are compared as a whole
+    unsigned int *pixels = (unsigned int *)rows->pixels;
+
+    for (int i = rowStart*rows->width; i < rowEnd*rows->width; i++)
+    {
+        if (pixels[i] == color) pixels[i] = replace;
+    }
+}
+#endif
+
+// Step of ResizeImageData(): output splits of a stb_image_resize2 operation
+static void ResizeImageSplits(void *data, int splitStart, int splitEnd)
+{
+    stbir_resize_extended_split((STBIR_RESIZE *)data, splitStart, splitEnd - splitStart);
+}
+
+// Resize 8 bit channels data (stb_image_resize2)
+// NOTE: Large images split the output into stb_image_resize2 splits run in parallel,
+// every split filters the same way so the result matches stbir_resize_uint8_linear()
+static void ResizeImageData(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels)
+{
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, input, width, height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)channels, STBIR_TYPE_UINT8);
+
+    int pixelCount = width*height + newWidth*newHeight;
+    int splitCount = stbir_build_samplers_with_splits(&resize, GetImageThreadCount(pixelCount));
+
+    if (splitCount > 0)
+    {
+        ProcessImageRows(ResizeImageSplits, &resize, splitCount, pixelCount);
+        stbir_free_samplers(&resize);
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Failed to resize image data");
+}
+
 #endif      // SUPPORT_MODULE_RTEXTURES
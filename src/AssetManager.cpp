@@ -1,4 +1,7 @@
 #include "AssetManager.h"
+#include "FontCache.h"
+#include "MemoryTracker.h"
+#include "TextureCache.h"
 #include <iostream>
 
 AssetManager::~AssetManager() {
@@ -7,10 +10,12 @@ AssetManager::~AssetManager() {
 
 // Texture management
 void AssetManager::LoadTexture(const std::string& name, const std::string& filePath) {
+    MemoryScope scope(MemoryTag::ASSETS);
     if (textures.find(name) != textures.end()) {
         ::UnloadTexture(textures[name]);
     }
-    textures[name] = ::LoadTexture(filePath.c_str());
+    // Decoded pixels come from the texture cache after the first run
+    textures[name] = TextureCache::LoadTexture(filePath);
 }
 
 Texture2D AssetManager::GetTexture(const std::string& name) {
@@ -58,10 +63,11 @@ Texture2D AssetManager::GetSpriteSheet(const std::string& name) {
 
 // Sound management
 void AssetManager::LoadSound(const std::string& name, const std::string& filePath) {
+    MemoryScope scope(MemoryTag::AUDIO);
     if (sounds.find(name) != sounds.end()) {
         ::UnloadSound(sounds[name]);
     }
-    sounds[name] = ::LoadSound(filePath.c_str());
+    sounds[name] = soundCache.LoadSound(filePath);
 }
 
 Sound AssetManager::GetSound(const std::string& name) {
@@ -78,10 +84,16 @@ bool AssetManager::HasSound(const std::string& name) const {
 
 // Font management
 void AssetManager::LoadFont(const std::string& name, const std::string& filePath) {
+    MemoryScope scope(MemoryTag::ASSETS);
     if (fonts.find(name) != fonts.end()) {
         ::UnloadFont(fonts[name]);
     }
-    fonts[name] = ::LoadFont(filePath.c_str());
+    // TrueType fonts go through the atlas cache, bitmap fonts (.fnt, images) load as-is
+    if (IsFileExtension(filePath.c_str(), ".ttf;.otf")) {
+        fonts[name] = FontCache::LoadFont(filePath, 32, nullptr, 95);
+    } else {
+        fonts[name] = ::LoadFont(filePath.c_str());
+    }
 }
 
 Font AssetManager::GetFont(const std::string& name) {
@@ -98,6 +110,7 @@ bool AssetManager::HasFont(const std::string& name) const {
 
 // Level data management
 void AssetManager::LoadLevelData(const std::string& name, const std::string& filePath) {
+    MemoryScope scope(MemoryTag::ASSETS);
     // Load binary level data
     unsigned int size = 0;
     unsigned char* data = LoadFileData(filePath.c_str(), &size);
@@ -136,9 +149,11 @@ void AssetManager::LoadTextures() {
 }
 
 void AssetManager::LoadSounds() {
-    // Load sounds for Diamond Rush
+    // Load sounds for Diamond Rush, pre-decoded from the sound cache when possible
+    soundCache.Open();
     LoadSound("diamond_collect", "resources/sounds/diamond_collect.wav");
     LoadSound("level_complete", "resources/sounds/level_complete.wav");
+    soundCache.Close();
 }
 
 void AssetManager::LoadFonts() {
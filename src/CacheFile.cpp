@@ -0,0 +1,21 @@
+#include "CacheFile.h"
+#include "../raylib/src/raylib.h"
+
+namespace CacheFile {
+    uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    uint64_t HashPath(const std::string& path) {
+        return HashBytes(HASH_SEED, path.data(), path.size());
+    }
+
+    SourceStamp GetSourceStamp(const std::string& filePath) {
+        return { HashPath(filePath), GetFileModTime(filePath.c_str()), GetFileLength(filePath.c_str()) };
+    }
+}
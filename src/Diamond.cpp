@@ -1,5 +1,6 @@
 #include "Diamond.h"
 #include "AssetManager.h"
+#include "ParticleSystem.h"
 #include <cmath> // For sinf
 
 Diamond::Diamond(float x, float y) {
@@ -30,6 +31,26 @@ void Diamond::Update() {
     }
 }
 
+void Diamond::Collect() {
+    collected = true;
+    
+    // Sparkle burst from the diamond center
+    ParticleSystem::GetInstance().Emit({position.x + 8, position.y + 8}, ParticleSystem::SPARKLE_DIAMOND);
+}
+
+Diamond::SaveData Diamond::GetSaveData() const {
+    return { position, animTime, sparkleTime, currentFrame, collected ? uint8_t(1) : uint8_t(0) };
+}
+
+void Diamond::ApplySaveData(const SaveData& data) {
+    position = data.position;
+    collider = { position.x, position.y, 16, 16 };
+    animTime = data.animTime;
+    sparkleTime = data.sparkleTime;
+    currentFrame = data.currentFrame;
+    collected = data.collected != 0;
+}
+
 void Diamond::Draw() {
     if (!collected) {
         // Draw diamond with animation
@@ -0,0 +1,272 @@
+#include "FontCache.h"
+#include "CacheFile.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Private copy of stb_truetype (rtext.c keeps its own static one)
+#define STBTT_malloc(x,u) ((void)(u),RL_MALLOC(x))
+#define STBTT_free(x,u) ((void)(u),RL_FREE(x))
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "../raylib/src/external/stb_truetype.h"
+
+namespace {
+    constexpr uint32_t CACHE_MAGIC = 0x43414652;    // "RFAC"
+    constexpr uint32_t CACHE_VERSION = 1;
+    constexpr int GLYPH_PADDING = 4;                // Same as raylib's FONT_TTF_DEFAULT_CHARS_PADDING
+    constexpr int GLYPH_BATCH = 16;                 // Glyphs claimed per worker fetch
+
+    struct CacheHeader {
+        CacheFile::Header common;
+        uint64_t key;
+        int32_t baseSize;
+        int32_t glyphPadding;
+        int32_t glyphCount;
+        int32_t atlasWidth;
+        int32_t atlasHeight;
+        int32_t atlasFormat;
+    };
+
+    struct CacheGlyph {
+        int32_t value;
+        int32_t offsetX;
+        int32_t offsetY;
+        int32_t advanceX;
+        Rectangle rec;
+    };
+
+    // One glyph, same output as raylib's LoadFontData() for FONT_DEFAULT
+    void RasterizeGlyph(const stbtt_fontinfo& fontInfo, float scale, int ascent, int fontSize, int codepoint, GlyphInfo& glyph) {
+        int width = 0;
+        int height = 0;
+
+        glyph.value = codepoint;
+        glyph.image.data = stbtt_GetCodepointBitmap(&fontInfo, scale, scale, codepoint, &width, &height, &glyph.offsetX, &glyph.offsetY);
+
+        if (glyph.image.data != nullptr) {
+            stbtt_GetCodepointHMetrics(&fontInfo, codepoint, &glyph.advanceX, nullptr);
+            glyph.advanceX = static_cast<int>(glyph.advanceX * scale);
+
+            glyph.image.width = width;
+            glyph.image.height = height;
+            glyph.image.mipmaps = 1;
+            glyph.image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+            glyph.offsetY += static_cast<int>(ascent * scale);
+        }
+
+        // Spaces (including CJK ideographic space) get an empty image of their advance width
+        if (codepoint == 0x20 || codepoint == 0x3000) {
+            stbtt_GetCodepointHMetrics(&fontInfo, codepoint, &glyph.advanceX, nullptr);
+            glyph.advanceX = static_cast<int>(glyph.advanceX * scale);
+
+            if (glyph.image.data != nullptr) {
+                RL_FREE(glyph.image.data);
+            }
+            glyph.image.data = RL_CALLOC(glyph.advanceX * fontSize, 2);
+            glyph.image.width = glyph.advanceX;
+            glyph.image.height = fontSize;
+            glyph.image.mipmaps = 1;
+            glyph.image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+        }
+    }
+}
+
+Font FontCache::LoadFont(const std::string& filePath, int fontSize, const int* codepoints, int codepointCount, int threadCount) {
+    int dataSize = 0;
+    unsigned char* fileData = LoadFileData(filePath.c_str(), &dataSize);
+    if (fileData == nullptr) {
+        return GetFontDefault();
+    }
+
+    // Same default character set as LoadFontEx()
+    std::vector<int> defaultCodepoints;
+    if (codepoints == nullptr) {
+        codepointCount = (codepointCount > 0) ? codepointCount : 95;
+        defaultCodepoints.resize(codepointCount);
+        for (int i = 0; i < codepointCount; i++) {
+            defaultCodepoints[i] = 32 + i;
+        }
+        codepoints = defaultCodepoints.data();
+    }
+
+    uint64_t key = ComputeKey(fileData, dataSize, fontSize, codepoints, codepointCount);
+    std::string cachePath = GetCachePath(key);
+
+    Font font = { 0 };
+    bool cacheHit = LoadFromCache(cachePath, key, font);
+
+    if (!cacheHit) {
+        int glyphCount = 0;
+        GlyphInfo* glyphs = RasterizeGlyphs(fileData, fontSize, codepoints, codepointCount, threadCount, glyphCount);
+
+        if (glyphs != nullptr) {
+            Rectangle* recs = nullptr;
+            Image atlas = GenImageFontAtlas(glyphs, &recs, glyphCount, fontSize, GLYPH_PADDING, 0);
+
+            font = LoadFontFromAtlas(atlas, glyphs, recs, glyphCount, fontSize, GLYPH_PADDING);
+            if (IsFontValid(font)) {
+                SaveToCache(cachePath, key, atlas, glyphs, recs, glyphCount, fontSize, GLYPH_PADDING);
+            }
+
+            UnloadImage(atlas);
+            UnloadFontData(glyphs, glyphCount);
+            MemFree(recs);
+        }
+    }
+
+    UnloadFileData(fileData);
+
+    if (!IsFontValid(font)) {
+        std::cerr << "Failed to load font: " << filePath << std::endl;
+        return GetFontDefault();
+    }
+
+    // Same filter raylib's LoadFont() sets
+    SetTextureFilter(font.texture, TEXTURE_FILTER_POINT);
+
+    return font;
+}
+
+uint64_t FontCache::ComputeKey(const unsigned char* fileData, int dataSize, int fontSize, const int* codepoints, int codepointCount) {
+    using CacheFile::HashBytes;
+    uint64_t hash = HashBytes(CacheFile::HASH_SEED, &CACHE_VERSION, sizeof(CACHE_VERSION));
+    hash = HashBytes(hash, fileData, static_cast<size_t>(dataSize));
+    hash = HashBytes(hash, &fontSize, sizeof(fontSize));
+    hash = HashBytes(hash, &GLYPH_PADDING, sizeof(GLYPH_PADDING));
+    hash = HashBytes(hash, &codepointCount, sizeof(codepointCount));
+    hash = HashBytes(hash, codepoints, static_cast<size_t>(codepointCount) * sizeof(int));
+    return hash;
+}
+
+std::string FontCache::GetCachePath(uint64_t key) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.rfa", static_cast<unsigned long long>(key));
+    return std::string(CACHE_DIRECTORY) + "/" + name;
+}
+
+GlyphInfo* FontCache::RasterizeGlyphs(const unsigned char* fileData, int fontSize, const int* codepoints, int codepointCount, int threadCount, int& glyphCount) {
+    glyphCount = 0;
+
+    stbtt_fontinfo fontInfo;
+    if (!stbtt_InitFont(&fontInfo, fileData, 0)) {
+        std::cerr << "Failed to process TTF font data" << std::endl;
+        return nullptr;
+    }
+
+    float scale = stbtt_ScaleForPixelHeight(&fontInfo, static_cast<float>(fontSize));
+    int ascent, descent, lineGap;
+    stbtt_GetFontVMetrics(&fontInfo, &ascent, &descent, &lineGap);
+
+    // Only codepoints present in the font get a glyph
+    std::vector<int> present;
+    present.reserve(codepointCount);
+    for (int i = 0; i < codepointCount; i++) {
+        if (stbtt_FindGlyphIndex(&fontInfo, codepoints[i]) > 0) {
+            present.push_back(codepoints[i]);
+        }
+    }
+    if (present.empty()) {
+        return nullptr;
+    }
+
+    GlyphInfo* glyphs = static_cast<GlyphInfo*>(RL_CALLOC(present.size(), sizeof(GlyphInfo)));
+    int count = static_cast<int>(present.size());
+
+    // The font info is only read while rasterizing, so all workers share it
+    std::atomic<int> nextGlyph(0);
+    auto worker = [&]() {
+        for (int first = nextGlyph.fetch_add(GLYPH_BATCH); first < count; first = nextGlyph.fetch_add(GLYPH_BATCH)) {
+            int last = std::min(first + GLYPH_BATCH, count);
+            for (int i = first; i < last; i++) {
+                RasterizeGlyph(fontInfo, scale, ascent, fontSize, present[i], glyphs[i]);
+            }
+        }
+    };
+
+    if (threadCount <= 0) {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    threadCount = std::min(threadCount, (count + GLYPH_BATCH - 1) / GLYPH_BATCH);
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < threadCount; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    glyphCount = count;
+    return glyphs;
+}
+
+bool FontCache::LoadFromCache(const std::string& cachePath, uint64_t key, Font& font) {
+    if (!FileExists(cachePath.c_str())) {
+        return false;
+    }
+
+    int size = 0;
+    unsigned char* data = LoadFileData(cachePath.c_str(), &size);
+    if (data == nullptr) {
+        return false;
+    }
+
+    StateReader reader(data, static_cast<size_t>(size));
+
+    CacheHeader header;
+    bool valid = CacheFile::ReadHeader(reader, CACHE_MAGIC, CACHE_VERSION, header) && header.key == key &&
+                 header.glyphCount > 0 && header.atlasWidth > 0 && header.atlasHeight > 0 &&
+                 static_cast<size_t>(header.glyphCount) * sizeof(CacheGlyph) <= reader.GetRemaining();
+
+    std::vector<GlyphInfo> glyphs;
+    std::vector<Rectangle> recs;
+    if (valid) {
+        glyphs.resize(header.glyphCount);
+        recs.resize(header.glyphCount);
+        for (int i = 0; i < header.glyphCount; i++) {
+            CacheGlyph glyph;
+            reader.Read(glyph);
+            glyphs[i] = { glyph.value, glyph.offsetX, glyph.offsetY, glyph.advanceX, { 0 } };
+            recs[i] = glyph.rec;
+        }
+
+        valid = static_cast<size_t>(GetPixelDataSize(header.atlasWidth, header.atlasHeight, header.atlasFormat)) == reader.GetRemaining();
+    }
+
+    if (valid) {
+        // Atlas pixels are the rest of the file, used in place
+        Image atlas = { data + (size - reader.GetRemaining()), header.atlasWidth, header.atlasHeight, 1, header.atlasFormat };
+        font = LoadFontFromAtlas(atlas, glyphs.data(), recs.data(), header.glyphCount, header.baseSize, header.glyphPadding);
+        valid = IsFontValid(font);
+    } else {
+        std::cerr << "Ignoring invalid font atlas cache: " << cachePath << std::endl;
+    }
+
+    UnloadFileData(data);
+    return valid;
+}
+
+void FontCache::SaveToCache(const std::string& cachePath, uint64_t key, const Image& atlas, const GlyphInfo* glyphs, const Rectangle* recs, int glyphCount, int fontSize, int padding) {
+    std::vector<uint8_t> buffer;
+    StateWriter writer(buffer);
+
+    CacheHeader header = { { CACHE_MAGIC, CACHE_VERSION }, key, fontSize, padding, glyphCount, atlas.width, atlas.height, atlas.format };
+    writer.Write(header);
+    for (int i = 0; i < glyphCount; i++) {
+        CacheGlyph glyph = { glyphs[i].value, glyphs[i].offsetX, glyphs[i].offsetY, glyphs[i].advanceX, recs[i] };
+        writer.Write(glyph);
+    }
+    writer.WriteBytes(atlas.data, GetPixelDataSize(atlas.width, atlas.height, atlas.format));
+
+    MakeDirectory(CACHE_DIRECTORY);
+    if (!SaveFileData(cachePath.c_str(), buffer.data(), static_cast<int>(buffer.size()))) {
+        std::cerr << "Failed to write font atlas cache: " << cachePath << std::endl;
+    }
+}
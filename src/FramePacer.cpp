@@ -0,0 +1,153 @@
+#include "FramePacer.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace {
+    // Bounds for the learned wake-up slack
+    constexpr double MIN_WAKE_SLACK = 0.0002;   // 0.2 ms
+    constexpr double MAX_WAKE_SLACK = 0.004;    // 4 ms, roughly the worst default scheduler tick
+    constexpr double SLACK_LEARN_RATE = 0.1;
+    constexpr double STATS_WINDOW = 1.0;        // Seconds between statistics refreshes
+}
+
+FramePacer::FramePacer()
+    : mode(Mode::PRECISE_SLEEP),
+      targetFPS(60),
+      idleFPS(15),
+      appliedFPS(-1),
+      isIdle(false),
+      started(false),
+      slack(0.001),
+      oversleepMean(0.001),
+      oversleepDeviation(0.0),
+      windowCpuStart(0),
+      errorSquaredSum(0),
+      errorMax(0),
+      windowFrames(0),
+      cpuUsage(0),
+      jitterMs(0),
+      maxErrorMs(0) {
+}
+
+void FramePacer::SetMode(Mode newMode) {
+    mode = newMode;
+    started = false;
+    appliedFPS = -1;
+}
+
+void FramePacer::SetTargetFPS(int fps) {
+    targetFPS = std::max(fps, 1);
+    appliedFPS = -1;
+}
+
+void FramePacer::SetIdleFPS(int fps) {
+    idleFPS = std::max(fps, 1);
+    appliedFPS = -1;
+}
+
+double FramePacer::GetTargetPeriod() const {
+    return 1.0 / (isIdle ? std::min(idleFPS, targetFPS) : targetFPS);
+}
+
+void FramePacer::WaitForNextFrame() {
+    Clock::time_point now = Clock::now();
+    double targetPeriod = GetTargetPeriod();
+
+    if (!started) {
+        started = true;
+        nextDeadline = now;
+        lastFrameEnd = now;
+        windowStart = now;
+        windowCpuStart = std::clock();
+    }
+
+    // Hand frame timing to raylib (legacy behaviour) or take it over completely
+    int wantedFPS = (mode == Mode::BUSY_WAIT) ? static_cast<int>(std::lround(1.0 / targetPeriod)) : 0;
+    if (wantedFPS != appliedFPS) {
+        ::SetTargetFPS(wantedFPS);
+        appliedFPS = wantedFPS;
+    }
+
+    if (mode != Mode::BUSY_WAIT) {
+        nextDeadline += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(targetPeriod));
+
+        // Fell behind (hitch, breakpoint, window drag): resync instead of rushing frames to catch up
+        if (nextDeadline < now) {
+            nextDeadline = now;
+        }
+
+        SleepUntil(nextDeadline);
+    }
+
+    Clock::time_point frameEnd = Clock::now();
+    UpdateStats(std::chrono::duration<double>(frameEnd - lastFrameEnd).count(), targetPeriod);
+    lastFrameEnd = frameEnd;
+}
+
+void FramePacer::SleepUntil(Clock::time_point deadline) {
+    Clock::time_point now = Clock::now();
+    double remaining = std::chrono::duration<double>(deadline - now).count();
+    double sleepTime = remaining - slack;
+
+    if (sleepTime > 0.0) {
+        Clock::time_point requestedWake = now + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(sleepTime));
+        std::this_thread::sleep_for(std::chrono::duration<double>(sleepTime));
+
+        // Learn how late the OS wakes us up
+        double oversleep = std::chrono::duration<double>(Clock::now() - requestedWake).count();
+        oversleepMean += SLACK_LEARN_RATE * (oversleep - oversleepMean);
+        oversleepDeviation += SLACK_LEARN_RATE * (std::fabs(oversleep - oversleepMean) - oversleepDeviation);
+
+        // Precise mode wakes up conservatively and spins the rest, low power mode aims for the average wake-up
+        double learned = (mode == Mode::PRECISE_SLEEP) ? oversleepMean + 3.0 * oversleepDeviation : oversleepMean;
+        slack = std::clamp(learned, MIN_WAKE_SLACK, MAX_WAKE_SLACK);
+    }
+
+    if (mode == Mode::PRECISE_SLEEP) {
+        while (Clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void FramePacer::UpdateStats(double framePeriod, double targetPeriod) {
+    double error = framePeriod - targetPeriod;
+    errorSquaredSum += error * error;
+    errorMax = std::max(errorMax, std::fabs(error));
+    windowFrames++;
+
+    Clock::time_point now = Clock::now();
+    double wallTime = std::chrono::duration<double>(now - windowStart).count();
+    if (wallTime < STATS_WINDOW) return;
+
+    std::clock_t cpuNow = std::clock();
+    cpuUsage = static_cast<float>((static_cast<double>(cpuNow - windowCpuStart) / CLOCKS_PER_SEC) / wallTime);
+    jitterMs = static_cast<float>(std::sqrt(errorSquaredSum / windowFrames) * 1000.0);
+    maxErrorMs = static_cast<float>(errorMax * 1000.0);
+
+    windowStart = now;
+    windowCpuStart = cpuNow;
+    errorSquaredSum = 0;
+    errorMax = 0;
+    windowFrames = 0;
+}
+
+void FramePacer::DrawStats(int x, int y, int fontSize) const {
+    DrawText(TextFormat("%s%s", GetModeName(mode), isIdle ? " (IDLE)" : ""), x, y, fontSize, GREEN);
+    DrawText(TextFormat("CPU: %.1f%%", cpuUsage * 100.0f), x, y + fontSize, fontSize, GREEN);
+    DrawText(TextFormat("JITTER: %.2f ms (MAX %.2f)", jitterMs, maxErrorMs), x, y + fontSize * 2, fontSize, GREEN);
+    DrawText(TextFormat("SLACK: %.2f ms", GetWakeSlackMs()), x, y + fontSize * 3, fontSize, GREEN);
+}
+
+const char* FramePacer::GetModeName(Mode mode) {
+    switch (mode) {
+        case Mode::BUSY_WAIT:
+            return "BUSY WAIT";
+        case Mode::PRECISE_SLEEP:
+            return "PRECISE SLEEP";
+        case Mode::LOW_POWER:
+            return "LOW POWER";
+    }
+    return "UNKNOWN";
+}
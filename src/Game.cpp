@@ -2,15 +2,24 @@
 #include "Player.h"
 #include "Level.h"
 #include "GameState.h"
+#include "InputQueue.h"
 #include "AssetManager.h"
+#include "ParticleSystem.h"
+#include "SaveState.h"
+#include "MemoryTracker.h"
+#include "SfxManager.h"
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <cmath>
+#include <utility>
 
-Game::Game() : isRunning(false), isPaused(false), score(0), collectedDiamonds(0), 
+Game::Game() : isRunning(false), isPaused(false), showDebugOverlay(false), isRewinding(false), endlessMode(false), steadyFrames(0),
+               levelArena(&LevelArena::GetInstance()), prefetchArena(&spareArena), restartChunks(0),
+               restartMicroseconds(0.0f), score(0), collectedDiamonds(0), 
                totalDiamonds(0), lives(3), currentLevelNumber(1), 
                currentSealPosition(SEAL_POS_ANGKOR), currentSealMoveDirection(SEAL_MOVE_NOOP),
-               sealArrowOffsetX(0), sealArrowOffsetY(0) {
+               sealArrowOffsetX(0), sealArrowOffsetY(0), hud(SCREEN_WIDTH, 110, BLANK) {
     Initialize();
 }
 
@@ -21,24 +30,41 @@ Game::~Game() {
 void Game::Initialize() {
     // Initialize raylib window
     InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Diamond Rush");
-    SetTargetFPS(60);
+    
+    // Frame timing is owned by the frame pacer (see FramePacer::WaitForNextFrame)
+    framePacer.SetTargetFPS(60);
+    framePacer.SetIdleFPS(15);
+    
+    // Input is polled by the game right before each tick instead of inside EndDrawing()
+    InputQueue::GetInstance().Initialize();
     
     // Initialize audio
-    InitAudioDevice();
+    {
+        MemoryScope scope(MemoryTag::AUDIO);
+        InitAudioDevice();
+    }
     
     // Load game assets
-    assetManager = std::make_unique<AssetManager>();
-    LoadResources();
+    {
+        MemoryScope scope(MemoryTag::ASSETS);
+        assetManager = std::make_unique<AssetManager>();
+        LoadResources();
+    }
     
     // Initialize game objects
     player = std::make_unique<Player>(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2);
     
     // Initialize level
-    currentLevel = std::make_unique<Level>(currentLevelNumber);
+    CreateLevel(currentLevelNumber);
     
     // Set player position based on level
     player->SetPosition(currentLevel->GetPlayerStartPosition().x, currentLevel->GetPlayerStartPosition().y);
     
+    // HUD values, the cached layer re-renders only when one of them changes
+    hud.AddWidget("SCORE: %d", 20, 20, 20, BLACK, [this]() { return score; });
+    hud.AddWidget("DIAMONDS: %d/%d", 20, 50, 20, BLACK, [this]() { return collectedDiamonds; }, [this]() { return totalDiamonds; });
+    hud.AddWidget("LIVES: %d", 20, 80, 20, BLACK, [this]() { return lives; });
+    
     // Initialize game state and set initial state to menu
     stateManager = std::make_unique<GameState>(this);
     
@@ -51,12 +77,49 @@ void Game::LoadResources() {
         assetManager->LoadTextures();
         assetManager->LoadSounds();
         assetManager->LoadFonts();
+        RegisterSoundEffects();
+    }
+}
+
+void Game::RegisterSoundEffects() {
+    // Sound, priority, instances, volume, audible distance (0 = everywhere)
+    struct Entry {
+        SfxId id;
+        const char* name;
+        SfxManager::Settings settings;
+    };
+    const Entry entries[] = {
+        { SfxId::DIAMOND_COLLECT, "diamond_collect", { 1, 4, 1.0f, 400.0f } },
+        { SfxId::LEVEL_COMPLETE, "level_complete", { 3, 1, 1.0f, 0.0f } },
+        { SfxId::JUMP, "jump", { 0, 2, 0.8f, 0.0f } },
+        { SfxId::DAMAGE, "damage", { 2, 2, 1.0f, 0.0f } },
+    };
+    
+    MemoryScope scope(MemoryTag::AUDIO);
+    for (const Entry& entry : entries) {
+        if (assetManager->HasSound(entry.name)) {
+            SfxManager::GetInstance().Register(entry.id, assetManager->GetSound(entry.name), entry.settings);
+        }
     }
 }
 
 void Game::Run() {
     // Main game loop
+    InputQueue& input = InputQueue::GetInstance();
     while (!WindowShouldClose() && isRunning) {
+        // Sample input as late as possible: after the frame wait, right before the tick
+        input.Latch();
+        
+        // Toggle pause with P key
+        if (input.IsKeyPressed(KEY_P)) {
+            isPaused = !isPaused;
+        }
+        
+        // Toggle debug overlay with F3 key
+        if (input.IsKeyPressed(KEY_F3)) {
+            showDebugOverlay = !showDebugOverlay;
+        }
+        
         // Only process input and update if not paused
         if (!isPaused) {
             ProcessInput();
@@ -75,11 +138,34 @@ void Game::Run() {
             DrawText("PAUSED", SCREEN_WIDTH/2 - 50, SCREEN_HEIGHT/2 - 10, 20, WHITE);
         }
         
+        // Draw debug overlay
+        if (showDebugOverlay) {
+            framePacer.DrawStats(5, SCREEN_HEIGHT - 45, 10);
+            DrawText(TextFormat("PARTICLES: %d", (int)ParticleSystem::GetInstance().GetLiveCount()), 5, SCREEN_HEIGHT - 55, 10, GREEN);
+            DrawText(TextFormat("REWIND: %.1f s", rewindBuffer.GetSecondsAvailable()), 5, SCREEN_HEIGHT - 65, 10, GREEN);
+            MemoryTracker::GetInstance().DrawStats(5, SCREEN_HEIGHT - 85, 10);
+            const SfxManager& sfx = SfxManager::GetInstance();
+            DrawText(TextFormat("SFX: %d VOICES, %u STOLEN, %u CULLED", sfx.GetActiveVoices(), sfx.GetStolenCount(), sfx.GetCulledCount()), 5, SCREEN_HEIGHT - 95, 10, GREEN);
+            input.DrawStats(5, SCREEN_HEIGHT - 115, 10);
+            DrawText(TextFormat("RESTART: %d CHUNKS IN %.0f US", (int)restartChunks, restartMicroseconds), 5, SCREEN_HEIGHT - 125, 10, GREEN);
+            DrawText(TextFormat("PREFETCH: %.2f MS, %s (%u OF %u WAITED)", prefetcher.GetLastBuildTimeMs(), prefetcher.WasLastTakeWaited() ? "WAITED" : "READY",
+                                prefetcher.GetWaitCount(), prefetcher.GetTakeCount()), 5, SCREEN_HEIGHT - 135, 10, GREEN);
+        }
+        
         EndDrawing();
         
-        // Toggle pause with P key
-        if (IsKeyPressed(KEY_P)) {
-            isPaused = !isPaused;
+        // Menus and pause screen run at the reduced idle frame rate
+        framePacer.SetIdle(isPaused || stateManager->IsIdle());
+        
+        // This tick's key events are on screen now, each must have made it within one frame
+        input.Present(framePacer.GetTargetPeriod());
+        framePacer.WaitForNextFrame();
+        
+        // Gameplay frames must not allocate once the level has warmed up
+        steadyFrames = (isPaused || stateManager->IsIdle()) ? 0 : steadyFrames + 1;
+        MemoryTracker::GetInstance().EndFrame(steadyFrames > STEADY_STATE_WARMUP_FRAMES);
+        if (MemoryTracker::GetInstance().HasFailed()) {
+            isRunning = false;
         }
     }
     
@@ -99,9 +185,27 @@ void Game::ProcessInput() {
 
 
 void Game::Shutdown() {
+    // Report frame pacing statistics
+    std::cout << "Frame pacing: " << FramePacer::GetModeName(framePacer.GetMode())
+              << ", CPU " << framePacer.GetCpuUsage() * 100.0f << "%"
+              << ", jitter " << framePacer.GetFrameJitterMs() << " ms"
+              << ", max error " << framePacer.GetMaxFrameErrorMs() << " ms" << std::endl;
+    InputQueue::GetInstance().PrintReport();
+    std::cout << "Level prefetch: " << prefetcher.GetTakeCount() << " levels taken, " << prefetcher.GetWaitCount()
+              << " transitions waited for the build" << std::endl;
+    
+    // Report allocations per subsystem (TRACK_ALLOCATIONS builds)
+    MemoryTracker::GetInstance().PrintReport();
+    
+    // Voices alias the asset sounds, release them first
+    SfxManager::GetInstance().Unload();
+    
     // Unload all assets
     AssetManager::GetInstance().UnloadAll();
     
+    // GPU resources go before the window
+    hud.Unload();
+    
     // Close audio device
     CloseAudioDevice();
     
@@ -109,14 +213,63 @@ void Game::Shutdown() {
     CloseWindow();
 }
 
+void Game::CreateLevel(int levelNumber) {
+    MemoryScope scope(MemoryTag::LEVEL);
+    steadyFrames = 0;
+    
+    // The old level's memory is reclaimed in one go, the new level reuses it
+    currentLevel.reset();
+    levelArena->Reset();
+    LevelArena::Scope arenaScope(*levelArena);
+    currentLevel.reset(levelArena->Create<Level>(levelNumber));
+}
+
+void Game::PrefetchNextLevel() {
+    int nextLevelNumber = currentLevelNumber + 1;
+    if (nextLevelNumber > AUTHORED_LEVEL_COUNT && !endlessMode) {
+        prefetcher.Cancel();
+        return;
+    }
+    
+    // Built into the arena the previous level was in, while this one is played
+    if (prefetcher.GetLevelNumber() != nextLevelNumber) {
+        prefetcher.Start(nextLevelNumber, *prefetchArena);
+    }
+}
+
 void Game::LoadLevel(int levelNumber) {
-    currentLevelNumber = levelNumber;
-    currentLevel = std::make_unique<Level>(levelNumber);
+    if (currentLevel && levelNumber == currentLevelNumber && currentLevel->CanRestart()) {
+        // Restart and retry: the level goes back to its initial state in place, nothing is rebuilt
+        MemoryScope scope(MemoryTag::LEVEL);
+        steadyFrames = 0;
+        auto start = std::chrono::steady_clock::now();
+        restartChunks = currentLevel->Restart();
+        restartMicroseconds = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count();
+    } else if (Level* prefetched = prefetcher.Take(levelNumber)) {
+        // Level transitions swap in the level built in the background
+        currentLevelNumber = levelNumber;
+        steadyFrames = 0;
+        currentLevel.reset(prefetched);
+        std::swap(levelArena, prefetchArena);
+    } else {
+        currentLevelNumber = levelNumber;
+        CreateLevel(levelNumber);
+    }
     totalDiamonds = currentLevel->GetDiamondCount();
     collectedDiamonds = 0;
     
+    // Drop effects and history left over from the previous level
+    ParticleSystem::GetInstance().Clear();
+    rewindBuffer.Clear();
+    isRewinding = false;
+    
     // Reset player position
     player->Reset(currentLevel->GetPlayerStartPosition().x, currentLevel->GetPlayerStartPosition().y);
+    
+    PrefetchNextLevel();
+    
+    // Loading is not frame work, the frame that loaded starts counting from here
+    MemoryTracker::GetInstance().BeginFrame();
 }
 
 void Game::AddScore(int points) {
@@ -127,8 +280,8 @@ void Game::CollectDiamond() {
     collectedDiamonds++;
     AddScore(100); // Each diamond is worth 100 points
     
-    // Play sound effect
-    PlaySound(AssetManager::GetInstance().GetSound("diamond_collect"));
+    // Play sound effect, layered with any still ringing
+    SfxManager::GetInstance().Play(SfxId::DIAMOND_COLLECT, player->GetPosition());
 }
 
 void Game::LoseLife() {
@@ -139,6 +292,92 @@ void Game::LoseLife() {
     }
 }
 
+void Game::SaveStateTo(std::vector<uint8_t>& buffer) const {
+    buffer.clear();
+    StateWriter writer(buffer);
+    
+    // Header size is patched once all sections are written
+    SaveState::Header header = { SaveState::MAGIC, SaveState::VERSION, 0, 0 };
+    writer.Write(header);
+    
+    // Game section
+    writer.Write(static_cast<int32_t>(score));
+    writer.Write(static_cast<int32_t>(collectedDiamonds));
+    writer.Write(static_cast<int32_t>(totalDiamonds));
+    writer.Write(static_cast<int32_t>(lives));
+    writer.Write(static_cast<int32_t>(currentLevelNumber));
+    
+    // Player and level sections
+    writer.Write(player->GetSaveData());
+    currentLevel->Serialize(writer);
+    
+    header.size = static_cast<uint32_t>(writer.GetSize());
+    memcpy(buffer.data(), &header, sizeof(header));
+}
+
+bool Game::LoadStateFrom(const uint8_t* data, size_t size) {
+    StateReader reader(data, size);
+    
+    SaveState::Header header;
+    if (!reader.Read(header) || header.magic != SaveState::MAGIC || header.version != SaveState::VERSION || header.size != size) {
+        std::cerr << "Invalid save state" << std::endl;
+        return false;
+    }
+    
+    int32_t values[5];
+    Player::SaveData playerData;
+    if (!reader.Read(values) || !reader.Read(playerData)) {
+        std::cerr << "Truncated save state" << std::endl;
+        return false;
+    }
+    
+    if (!currentLevel) {
+        CreateLevel(values[4]);
+    }
+    
+    if (!currentLevel->Deserialize(reader)) {
+        std::cerr << "Corrupted level section in save state" << std::endl;
+        return false;
+    }
+    
+    score = values[0];
+    collectedDiamonds = values[1];
+    totalDiamonds = values[2];
+    lives = values[3];
+    currentLevelNumber = values[4];
+    player->ApplySaveData(playerData);
+    
+    return true;
+}
+
+void Game::QuickSave() {
+    auto start = std::chrono::steady_clock::now();
+    SaveStateTo(quickSaveBuffer);
+    auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    
+    std::cout << "Quick save: " << quickSaveBuffer.size() << " bytes in " << elapsed << " us" << std::endl;
+}
+
+bool Game::QuickLoad() {
+    if (quickSaveBuffer.empty()) {
+        std::cout << "Quick load: no quick save" << std::endl;
+        return false;
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    bool loaded = LoadStateFrom(quickSaveBuffer.data(), quickSaveBuffer.size());
+    auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    
+    if (loaded) {
+        steadyFrames = 0;
+        ParticleSystem::GetInstance().Clear();
+        rewindBuffer.Clear();
+        MemoryTracker::GetInstance().BeginFrame();
+        std::cout << "Quick load: " << quickSaveBuffer.size() << " bytes in " << elapsed << " us" << std::endl;
+    }
+    return loaded;
+}
+
 void Game::Update() {
     float deltaTime = GetFrameTime();
     
@@ -146,6 +385,29 @@ void Game::Update() {
         stateManager->Update(deltaTime);
     }
     
+    // Update effects
+    ParticleSystem::GetInstance().Update(deltaTime);
+    
+    // Start sound effects triggered this frame, heard from the player
+    if (player) {
+        SfxManager::GetInstance().SetListener(player->GetPosition());
+    }
+    SfxManager::GetInstance().Update();
+    
+    // Rewinding replaces the simulation tick with a step back in history
+    if (isRewinding && currentLevel && player) {
+        Player::SaveData playerData;
+        RewindBuffer::Counters counters;
+        if (rewindBuffer.StepBack(*currentLevel, playerData, counters)) {
+            player->ApplySaveData(playerData);
+            score = counters.score;
+            lives = counters.lives;
+            collectedDiamonds = counters.collectedDiamonds;
+            currentLevel->SetExitReached(counters.exitReached != 0);
+        }
+        return;
+    }
+    
     // Update game objects
     if (currentLevel) {
         currentLevel->Update(deltaTime);
@@ -159,6 +421,10 @@ void Game::Update() {
                 CollectDiamond();
                 player->ResetDiamondCollected();
             }
+            
+            // Record the end-of-tick state for rewinding
+            RewindBuffer::Counters counters = { score, lives, collectedDiamonds, static_cast<uint8_t>(currentLevel->IsExitReached() ? 1 : 0) };
+            rewindBuffer.Record(*currentLevel, player->GetSaveData(), counters);
         }
     }
 }
@@ -172,15 +438,16 @@ void Game::Render() {
         currentLevel->Draw();
     }
     
+    // Draw effects
+    ParticleSystem::GetInstance().Draw();
+    
     // Draw player
     if (player) {
         player->Draw();
     }
     
     // Draw UI
-    DrawText(TextFormat("SCORE: %d", score), 20, 20, 20, BLACK);
-    DrawText(TextFormat("DIAMONDS: %d/%d", collectedDiamonds, totalDiamonds), 20, 50, 20, BLACK);
-    DrawText(TextFormat("LIVES: %d", lives), 20, 80, 20, BLACK);
+    hud.Draw(0, 0);
     
     EndDrawing();
 }
\ No newline at end of file
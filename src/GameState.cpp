@@ -2,6 +2,10 @@
 #include "Game.h"
 #include "GameState.h"
 #include "AssetManager.h"
+#include "InputQueue.h"
+#include "Level.h"
+#include "MemoryTracker.h"
+#include "SfxManager.h"
 #include <iostream>
 #include <memory>
 #include "raylib.h"
@@ -22,11 +26,13 @@ void MenuState::Exit() {
 }
 
 void MenuState::ProcessInput() {
+    const InputQueue& input = InputQueue::GetInstance();
+    
     if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         Vector2 mousePos = GetMousePosition();
         
         if (CheckCollisionPointRec(mousePos, playButton)) {
-            game->GetStateManager().ChangeState(std::make_unique<GameplayState>(game));
+            game->GetStateManager().ChangeState<GameplayState>();
         }
         else if (CheckCollisionPointRec(mousePos, exitButton)) {
             game->Quit();
@@ -34,13 +40,13 @@ void MenuState::ProcessInput() {
     }
     
     // Keyboard navigation
-    if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_UP)) {
+    if (input.IsKeyPressed(KEY_DOWN) || input.IsKeyPressed(KEY_UP)) {
         selectedOption = (selectedOption == 0) ? 1 : 0;
     }
     
-    if (IsKeyPressed(KEY_ENTER)) {
+    if (input.IsKeyPressed(KEY_ENTER)) {
         if (selectedOption == 0) {
-            game->GetStateManager().ChangeState(std::make_unique<GameplayState>(game));
+            game->GetStateManager().ChangeState<GameplayState>();
         }
         else {
             game->Quit();
@@ -71,7 +77,13 @@ void MenuState::Render() {
 
 // GameplayState Implementation
 GameplayState::GameplayState(Game* game) 
-    : GameState(game), currentLevel(1), levelCompleted(false), levelCompletedTimer(0) {
+    : GameState(game), currentLevel(1), levelCompleted(false), levelCompletedTimer(0),
+      hud(GetScreenWidth(), 40, ColorAlpha(BLACK, 0.7f)) {
+    // Top bar, re-rendered only when one of these values changes
+    hud.AddWidget("LEVEL: %d", 20, 10, 20, WHITE, [this]() { return currentLevel; });
+    hud.AddWidget("SCORE: %d", 200, 10, 20, WHITE, [game]() { return game->GetScore(); });
+    hud.AddWidget("DIAMONDS: %d/%d", 400, 10, 20, WHITE, [game]() { return game->GetCollectedDiamonds(); }, [game]() { return game->GetTotalDiamonds(); });
+    hud.AddWidget("LIVES: %d", 700, 10, 20, WHITE, [game]() { return game->GetLives(); });
 }
 
 void GameplayState::Enter() {
@@ -84,15 +96,17 @@ void GameplayState::Exit() {
 }
 
 void GameplayState::ProcessInput() {
+    const InputQueue& input = InputQueue::GetInstance();
+    
     if (levelCompleted) {
-        if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE)) {
-            if (currentLevel < 3) { // Assuming 3 levels total
+        if (input.IsKeyPressed(KEY_ENTER) || input.IsKeyPressed(KEY_SPACE)) {
+            if (currentLevel < AUTHORED_LEVEL_COUNT || game->IsEndlessMode()) {
                 currentLevel++;
                 LoadLevel(currentLevel);
             }
             else {
                 // Game completed, return to menu
-                game->GetStateManager().ChangeState(std::make_unique<MenuState>(game));
+                game->GetStateManager().ChangeState<MenuState>();
             }
         }
         return;
@@ -102,12 +116,24 @@ void GameplayState::ProcessInput() {
     game->GetPlayer().ProcessInput();
     
     // Debug keys
-    if (IsKeyPressed(KEY_R)) {
+    if (input.IsKeyPressed(KEY_R)) {
         RestartLevel();
     }
     
-    if (IsKeyPressed(KEY_ESCAPE)) {
-        game->GetStateManager().ChangeState(std::make_unique<MenuState>(game));
+    // Hold BACKSPACE to rewind
+    game->SetRewinding(input.IsKeyDown(KEY_BACKSPACE));
+    
+    // Quick save / quick load
+    if (input.IsKeyPressed(KEY_F5)) {
+        game->QuickSave();
+    }
+    
+    if (input.IsKeyPressed(KEY_F9)) {
+        game->QuickLoad();
+    }
+    
+    if (input.IsKeyPressed(KEY_ESCAPE)) {
+        game->GetStateManager().ChangeState<MenuState>();
     }
 }
 
@@ -115,13 +141,13 @@ void GameplayState::Update(float deltaTime) {
     if (levelCompleted) {
         levelCompletedTimer += deltaTime;
         if (levelCompletedTimer > 3.0f) { // Wait 3 seconds before auto-advancing
-            if (currentLevel < 3) {
+            if (currentLevel < AUTHORED_LEVEL_COUNT || game->IsEndlessMode()) {
                 currentLevel++;
                 LoadLevel(currentLevel);
             }
             else {
                 // Game completed, return to menu
-                game->GetStateManager().ChangeState(std::make_unique<MenuState>(game));
+                game->GetStateManager().ChangeState<MenuState>();
             }
         }
         return;
@@ -135,12 +161,12 @@ void GameplayState::Update(float deltaTime) {
         levelCompleted = true;
         levelCompletedTimer = 0;
         // Play completion sound
-        PlaySound(AssetManager::GetInstance().GetSound("level_complete"));
+        SfxManager::GetInstance().Play(SfxId::LEVEL_COMPLETE);
     }
     
     // Check for player death
     if (game->GetPlayer().IsDead()) {
-        game->GetStateManager().ChangeState(std::make_unique<GameOverState>(game));
+        game->GetStateManager().ChangeState<GameOverState>();
     }
 }
 
@@ -153,12 +179,8 @@ void GameplayState::Render() {
     // Render player
     game->GetPlayer().Render();
     
-    // Render UI
-    DrawRectangle(0, 0, GetScreenWidth(), 40, ColorAlpha(BLACK, 0.7f));
-    DrawText(TextFormat("LEVEL: %d", currentLevel), 20, 10, 20, WHITE);
-    DrawText(TextFormat("SCORE: %d", game->GetScore()), 200, 10, 20, WHITE);
-    DrawText(TextFormat("DIAMONDS: %d/%d", game->GetCollectedDiamonds(), game->GetTotalDiamonds()), 400, 10, 20, WHITE);
-    DrawText(TextFormat("LIVES: %d", game->GetLives()), 700, 10, 20, WHITE);
+    // Render UI (cached)
+    hud.Draw(0, 0);
     
     // Render level completed message
     if (levelCompleted) {
@@ -192,23 +214,25 @@ void GameOverState::Exit() {
 }
 
 void GameOverState::ProcessInput() {
+    const InputQueue& input = InputQueue::GetInstance();
+    
     if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         Vector2 mousePos = GetMousePosition();
         
         if (CheckCollisionPointRec(mousePos, retryButton)) {
-            game->GetStateManager().ChangeState(std::make_unique<GameplayState>(game));
+            game->GetStateManager().ChangeState<GameplayState>();
         }
         else if (CheckCollisionPointRec(mousePos, menuButton)) {
-            game->GetStateManager().ChangeState(std::make_unique<MenuState>(game));
+            game->GetStateManager().ChangeState<MenuState>();
         }
     }
     
-    if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE)) {
-        game->GetStateManager().ChangeState(std::make_unique<GameplayState>(game));
+    if (input.IsKeyPressed(KEY_ENTER) || input.IsKeyPressed(KEY_SPACE)) {
+        game->GetStateManager().ChangeState<GameplayState>();
     }
     
-    if (IsKeyPressed(KEY_ESCAPE)) {
-        game->GetStateManager().ChangeState(std::make_unique<MenuState>(game));
+    if (input.IsKeyPressed(KEY_ESCAPE)) {
+        game->GetStateManager().ChangeState<MenuState>();
     }
 }
 
@@ -230,35 +254,63 @@ void GameOverState::Render() {
 }
 
 // GameStateManager Implementation
-GameStateManager::GameStateManager(Game* game) : game(game), currentState(nullptr) {
+GameStateManager::GameStateManager(Game* game) : game(game), currentState(nullptr), pendingState(nullptr) {
+}
+
+GameStateManager::~GameStateManager() {
+    DestroyState(pendingState);
+    DestroyState(currentState);
 }
 
-void GameStateManager::ChangeState(std::unique_ptr<GameState> newState) {
+void GameStateManager::DestroyState(GameState*& state) {
+    if (state) {
+        state->~GameState();
+        state = nullptr;
+    }
+}
+
+void GameStateManager::ApplyPendingState() {
+    if (!pendingState) {
+        return;
+    }
+    
     if (currentState) {
         currentState->Exit();
     }
+    DestroyState(currentState);
     
-    currentState = std::move(newState);
+    // Rewinding is held down in gameplay only, it never carries over into another state
+    game->SetRewinding(false);
     
-    if (currentState) {
-        currentState->Enter();
-    }
+    currentState = pendingState;
+    pendingState = nullptr;
+    currentState->Enter();
 }
 
 void GameStateManager::ProcessInput() {
+    MemoryScope scope(MemoryTag::GAME_STATE);
+    ApplyPendingState();
     if (currentState) {
         currentState->ProcessInput();
     }
 }
 
 void GameStateManager::Update(float deltaTime) {
+    MemoryScope scope(MemoryTag::GAME_STATE);
+    ApplyPendingState();
     if (currentState) {
         currentState->Update(deltaTime);
     }
 }
 
 void GameStateManager::Render() {
+    MemoryScope scope(MemoryTag::GAME_STATE);
+    ApplyPendingState();
     if (currentState) {
         currentState->Render();
     }
+}
+
+bool GameStateManager::IsIdle() const {
+    return currentState && currentState->IsIdle();
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "HeadlessHost.h"
+
+#if defined(PLATFORM_HEADLESS)
+#include <iostream>
+
+HeadlessHost& HeadlessHost::GetInstance() {
+    static HeadlessHost instance;
+    return instance;
+}
+
+HeadlessHost::HeadlessHost()
+    : replay{ 0 }, hasReplay(false), frameLimit(0), presentedFrames(0), capturedFrames(0),
+      captureWidth(0), captureHeight(0), isRunning(false) {
+}
+
+HeadlessHost::~HeadlessHost() {
+    Stop();
+    if (hasReplay) {
+        UnloadAutomationEventList(replay);
+    }
+}
+
+bool HeadlessHost::OpenReplay(const std::string& filePath) {
+    if (!FileExists(filePath.c_str())) {
+        std::cerr << "Replay file not found: " << filePath << std::endl;
+        return false;
+    }
+
+    if (hasReplay) {
+        UnloadAutomationEventList(replay);
+    }
+    replay = LoadAutomationEventList(filePath.c_str());
+    hasReplay = true;
+
+    std::cout << "Replaying " << replay.count << " input events from " << filePath << std::endl;
+    return true;
+}
+
+bool HeadlessHost::OpenCapture(const std::string& filePath) {
+    capture.open(filePath, std::ios::binary | std::ios::trunc);
+    if (!capture) {
+        std::cerr << "Failed to open frame capture: " << filePath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void HeadlessHost::Start() {
+    if (hasReplay) {
+        SetHeadlessAutomationEventList(&replay);
+    }
+    SetHeadlessFrameCallback(&HeadlessHost::OnFrame);
+
+    presentedFrames = 0;
+    capturedFrames = 0;
+    startTime = std::chrono::steady_clock::now();
+    isRunning = true;
+}
+
+void HeadlessHost::Stop() {
+    if (!isRunning) {
+        return;
+    }
+    isRunning = false;
+
+    if (IsWindowReady()) {
+        SetHeadlessFrameCallback(nullptr);
+        SetHeadlessAutomationEventList(nullptr);
+    }
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    std::cout << "Headless run: " << presentedFrames << " frames in " << elapsed << " s";
+    if (elapsed > 0.0) {
+        std::cout << " (" << presentedFrames / elapsed << " fps)";
+    }
+    std::cout << std::endl;
+
+    if (capture.is_open()) {
+        capture.close();
+        std::cout << "Captured " << capturedFrames << " frames (" << captureWidth << "x" << captureHeight
+                  << " RGBA)" << std::endl;
+    }
+}
+
+void HeadlessHost::OnFrame(unsigned int frame) {
+    HeadlessHost& host = GetInstance();
+    host.presentedFrames = frame;
+
+    if (host.capture.is_open()) {
+        int width = 0;
+        int height = 0;
+        const unsigned char* pixels = GetHeadlessFrameBuffer(&width, &height);
+
+        // A raw stream can't change size midway, later frames of another size are skipped
+        if (host.capturedFrames == 0) {
+            host.captureWidth = width;
+            host.captureHeight = height;
+        }
+        if (pixels != nullptr && width == host.captureWidth && height == host.captureHeight) {
+            host.capture.write(reinterpret_cast<const char*>(pixels), static_cast<std::streamsize>(width) * height * 4);
+            host.capturedFrames++;
+        }
+    }
+
+    if (host.frameLimit > 0 && frame >= host.frameLimit) {
+        PushHeadlessClose();
+    }
+}
+#endif
@@ -0,0 +1,124 @@
+#include "HudLayer.h"
+#include "../raylib/src/rlgl.h"
+#include <iostream>
+
+HudLayer::HudLayer(int width, int height, Color background)
+    : widgetCount(0), width(width), height(height), background(background), target{ 0 }, isDirty(true), directMode(false), redrawCount(0) {
+}
+
+HudLayer::~HudLayer() {
+    // Render textures die with the GL context, only unload while it is still around
+    if (IsWindowReady()) {
+        Unload();
+    }
+}
+
+void HudLayer::AddWidget(const char* format, int x, int y, int fontSize, Color color, Binding value, Binding secondValue) {
+    if (widgetCount >= MAX_WIDGETS) {
+        std::cerr << "HUD widget limit reached, dropping: " << format << std::endl;
+        return;
+    }
+
+    Widget& widget = widgets[widgetCount++];
+    widget.format = format;
+    widget.x = x;
+    widget.y = y;
+    widget.fontSize = fontSize;
+    widget.color = color;
+    widget.value = std::move(value);
+    widget.secondValue = std::move(secondValue);
+    widget.cachedValue = 0;
+    widget.cachedSecondValue = 0;
+    isDirty = true;
+}
+
+void HudLayer::Unload() {
+    if (target.id != 0) {
+        UnloadRenderTexture(target);
+        target = { 0 };
+    }
+}
+
+bool HudLayer::RefreshValues() {
+    bool changed = false;
+    for (int i = 0; i < widgetCount; i++) {
+        Widget& widget = widgets[i];
+        int value = widget.value ? widget.value() : 0;
+        int secondValue = widget.secondValue ? widget.secondValue() : 0;
+        if (value != widget.cachedValue || secondValue != widget.cachedSecondValue) {
+            widget.cachedValue = value;
+            widget.cachedSecondValue = secondValue;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+bool HudLayer::IsCacheAvailable() {
+    if (target.id == 0 && !directMode) {
+        // Render textures need framebuffer objects, OpenGL 1.1 and the software renderer have none
+        int version = rlGetVersion();
+        if (version != RL_OPENGL_11 && version != RL_OPENGL_11_SOFTWARE) {
+            target = LoadRenderTexture(width, height);
+        }
+
+        if (target.id == 0) {
+            if (target.texture.id != 0) {
+                rlUnloadTexture(target.texture.id);
+            }
+            target = { 0 };
+            directMode = true;
+        }
+    }
+    return !directMode;
+}
+
+void HudLayer::DrawWidgets(int x, int y) const {
+    for (int i = 0; i < widgetCount; i++) {
+        const Widget& widget = widgets[i];
+        DrawText(TextFormat(widget.format, widget.cachedValue, widget.cachedSecondValue), x + widget.x, y + widget.y, widget.fontSize, widget.color);
+    }
+}
+
+void HudLayer::Redraw() {
+    // The texture holds premultiplied alpha: blending it onto the screen then gives exactly
+    // what drawing the background and the text straight to the screen would
+    BeginTextureMode(target);
+    ClearBackground(Color{ static_cast<unsigned char>(background.r * background.a / 255),
+                           static_cast<unsigned char>(background.g * background.a / 255),
+                           static_cast<unsigned char>(background.b * background.a / 255), background.a });
+
+    // Text comes out of the shader with straight alpha, premultiply it on the way in
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+    DrawWidgets(0, 0);
+    EndBlendMode();
+
+    EndTextureMode();
+
+    isDirty = false;
+    redrawCount++;
+}
+
+void HudLayer::Draw(int x, int y) {
+    bool changed = RefreshValues();
+
+    // No render texture: plain alpha blended widgets straight to the screen
+    if (!IsCacheAvailable()) {
+        if (background.a > 0) {
+            DrawRectangle(x, y, width, height, background);
+        }
+        DrawWidgets(x, y);
+        return;
+    }
+
+    if (changed || isDirty) {
+        Redraw();
+    }
+
+    // Render textures are stored bottom-up
+    Rectangle source = { 0, 0, static_cast<float>(width), -static_cast<float>(height) };
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTextureRec(target.texture, source, { static_cast<float>(x), static_cast<float>(y) }, WHITE);
+    EndBlendMode();
+}
@@ -0,0 +1,154 @@
+#include "InputQueue.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    constexpr double STATS_WINDOW = 1.0;        // Seconds between statistics refreshes
+}
+
+InputQueue& InputQueue::GetInstance() {
+    static InputQueue instance;
+    return instance;
+}
+
+InputQueue::InputQueue()
+    : events(),
+      eventCount(0),
+      latchTime(0.0),
+      previousLatchTime(0.0),
+      windowStart(0.0),
+      responseSum(0.0),
+      responseMax(0.0),
+      latencyMax(0.0),
+      windowActions(0),
+      responseMs(0.0f),
+      maxResponseMs(0.0f),
+      worstLatencyMs(0.0f),
+      sessionResponseSum(0.0),
+      sessionResponseMax(0.0),
+      sessionLatencyMax(0.0),
+      actionCount(0),
+      overBudgetCount(0),
+      droppedCount(0) {
+}
+
+void InputQueue::Initialize() {
+    SetInputPollingManual(true);
+
+    latchTime = GetTime();
+    previousLatchTime = latchTime;
+    windowStart = latchTime;
+}
+
+void InputQueue::Latch() {
+    PollInputEvents();
+
+    previousLatchTime = latchTime;
+    latchTime = GetTime();
+    eventCount = 0;
+    pressed.reset();
+    released = pendingRelease;
+    pendingRelease.reset();
+
+    // Taps seen by the previous latch were down for that tick, their release is due now
+    if (released.any()) {
+        for (int key = 1; key < MAX_KEYS; key++) {
+            if (released[key]) {
+                PushEvent(key, false);
+            }
+        }
+    }
+
+    // Presses in arrival order, including keys released again before this poll
+    for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed()) {
+        if (IsValidKey(key) && !pressed[key]) {
+            pressed.set(key);
+            PushEvent(key, true);
+        }
+    }
+
+    for (int key = 1; key < MAX_KEYS; key++) {
+        bool isDown = ::IsKeyDown(key);
+        if (isDown && !down[key] && !pressed[key]) {
+            pressed.set(key);
+            PushEvent(key, true);
+        }
+        if (!isDown && pressed[key]) {
+            pendingRelease.set(key);
+        } else if (!isDown && down[key]) {
+            released.set(key);
+            PushEvent(key, false);
+        }
+        down[key] = isDown;
+    }
+}
+
+void InputQueue::PushEvent(int key, bool isDown) {
+    if (eventCount == MAX_EVENTS) {
+        droppedCount++;
+        return;
+    }
+    events[eventCount++] = { key, isDown, latchTime, previousLatchTime };
+}
+
+void InputQueue::Present(double budget) {
+    double now = GetTime();
+
+    // Every key press of this tick reached the screen with this frame
+    int presses = 0;
+    for (int i = 0; i < eventCount; i++) {
+        if (events[i].down) {
+            presses++;
+        }
+    }
+
+    if (presses > 0) {
+        double response = now - latchTime;
+        double latency = now - previousLatchTime;
+
+        responseSum += response * presses;
+        responseMax = std::max(responseMax, response);
+        latencyMax = std::max(latencyMax, latency);
+        windowActions += presses;
+
+        sessionResponseSum += response * presses;
+        sessionResponseMax = std::max(sessionResponseMax, response);
+        sessionLatencyMax = std::max(sessionLatencyMax, latency);
+        actionCount += presses;
+        if (budget > 0.0 && response > budget) {
+            overBudgetCount += presses;
+        }
+    }
+
+    if (now - windowStart < STATS_WINDOW) return;
+
+    // Quiet windows keep showing the last measured values
+    if (windowActions > 0) {
+        responseMs = static_cast<float>(responseSum / windowActions * 1000.0);
+        maxResponseMs = static_cast<float>(responseMax * 1000.0);
+        worstLatencyMs = static_cast<float>(latencyMax * 1000.0);
+    }
+
+    windowStart = now;
+    responseSum = 0;
+    responseMax = 0;
+    latencyMax = 0;
+    windowActions = 0;
+}
+
+void InputQueue::DrawStats(int x, int y, int fontSize) const {
+    DrawText(TextFormat("INPUT: %.2f ms (MAX %.2f), WORST %.2f ms", responseMs, maxResponseMs, worstLatencyMs), x, y, fontSize, GREEN);
+    DrawText(TextFormat("ACTIONS: %u, %u OVER A FRAME", actionCount, overBudgetCount), x, y + fontSize, fontSize, GREEN);
+}
+
+void InputQueue::PrintReport() const {
+    double meanResponse = (actionCount > 0) ? sessionResponseSum / actionCount : 0.0;
+    std::cout << "Input latency: " << actionCount << " actions"
+              << ", response " << meanResponse * 1000.0 << " ms (max " << sessionResponseMax * 1000.0 << " ms)"
+              << ", input-to-present at most " << sessionLatencyMax * 1000.0 << " ms"
+              << ", " << overBudgetCount << " over a frame";
+    if (droppedCount > 0) {
+        std::cout << ", " << droppedCount << " events dropped";
+    }
+    std::cout << std::endl;
+}
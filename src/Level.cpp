@@ -1,12 +1,25 @@
 #include "Level.h"
 #include "AssetManager.h"
+#include "ParticleSystem.h"
+#include "SaveState.h"
+#include "MemoryTracker.h"
 #include <iostream>
 #include <memory>
 #include <fstream>
 #include <sstream>
+#include <cstring>
+#include <algorithm>
 
-Level::Level(int levelNumber) : levelNumber(levelNumber), exitReached(false), width(20), height(15) {
+Level::Level(int levelNumber) : levelNumber(levelNumber), exitReached(false), width(20), height(15),
+                                 allTilesDirty(false), hasPristineState(false) {
     LoadLevel(levelNumber);
+    CapturePristineState();
+}
+
+Level::Level(int levelNumber, const LevelGenerator::Settings& settings) : levelNumber(levelNumber), exitReached(false), width(0), height(0),
+                                                                         allTilesDirty(false), hasPristineState(false) {
+    Generate(settings);
+    CapturePristineState();
 }
 
 void Level::LoadLevel(int levelNumber) {
@@ -19,17 +32,41 @@ void Level::LoadLevel(int levelNumber) {
     // Try to load level data from file
     std::string levelFile = "level_" + std::to_string(levelNumber) + ".txt";
     
+    if (levelNumber > AUTHORED_LEVEL_COUNT) {
+        Generate(LevelGenerator::GetEndlessSettings(levelNumber));
+        return;
+    }
+    
     // For now, create a test level
     CreateTestLevel();
 }
 
+void Level::Generate(const LevelGenerator::Settings& settings) {
+    LevelGenerator::Output output;
+    LevelGenerator::Generate(settings, output);
+    
+    width = output.width;
+    height = output.height;
+    tiles.assign(output.tiles.begin(), output.tiles.end());
+    
+    diamonds.clear();
+    diamonds.reserve(output.diamondCells.size());
+    for (int cell : output.diamondCells) {
+        diamonds.emplace_back((cell % width) * TILE_SIZE, (cell / width) * TILE_SIZE);
+    }
+    
+    playerStartPosition = {static_cast<float>((output.startCell % width) * TILE_SIZE), static_cast<float>((output.startCell / width) * TILE_SIZE)};
+    exitPosition = {static_cast<float>((output.exitCell % width) * TILE_SIZE), static_cast<float>((output.exitCell / width) * TILE_SIZE)};
+    exitReached = false;
+}
+
 void Level::CreateTestLevel() {
     // Set dimensions for test level
     width = 20;
     height = 15;
     
     // Initialize tiles with empty spaces
-    tiles.resize(width * height, TileType::EMPTY);
+    tiles.assign(width * height, TileType::EMPTY);
     
     // Create walls around the perimeter
     for (int x = 0; x < width; x++) {
@@ -48,9 +85,10 @@ void Level::CreateTestLevel() {
     }
     
     // Add some diamonds
-    diamonds.push_back(std::make_unique<Diamond>(5 * TILE_SIZE, 10 * TILE_SIZE));
-    diamonds.push_back(std::make_unique<Diamond>(10 * TILE_SIZE, 10 * TILE_SIZE));
-    diamonds.push_back(std::make_unique<Diamond>(15 * TILE_SIZE, 10 * TILE_SIZE));
+    diamonds.reserve(3);
+    diamonds.emplace_back(5 * TILE_SIZE, 10 * TILE_SIZE);
+    diamonds.emplace_back(10 * TILE_SIZE, 10 * TILE_SIZE);
+    diamonds.emplace_back(15 * TILE_SIZE, 10 * TILE_SIZE);
     
     // Set player start position
     playerStartPosition = {TILE_SIZE * 2, TILE_SIZE * 10};
@@ -72,18 +110,24 @@ void Level::SetTileAt(int x, int y, TileType type) {
         return; // Out of bounds
     }
     tiles[y * width + x] = type;
+    MarkTileDirty(y * width + x);
 }
 
 void Level::BreakTile(int x, int y) {
-    if (GetTileAt(x, y) == TileType::BREAKABLE || GetTileAt(x, y) == TileType::DIRT) {
+    TileType tile = GetTileAt(x, y);
+    if (tile == TileType::BREAKABLE || tile == TileType::DIRT) {
         SetTileAt(x, y, TileType::EMPTY);
+        
+        // Debris burst from the tile center
+        Vector2 center = {x * TILE_SIZE + TILE_SIZE / 2.0f, y * TILE_SIZE + TILE_SIZE / 2.0f};
+        ParticleSystem::GetInstance().Emit(center, (tile == TileType::DIRT) ? ParticleSystem::DEBRIS_DIRT : ParticleSystem::DEBRIS_BREAKABLE);
     }
 }
 
 void Level::Update() {
     // Update all diamonds
     for (auto& diamond : diamonds) {
-        diamond->Update();
+        diamond.Update();
     }
 }
 
@@ -128,15 +172,15 @@ void Level::Draw() {
     
     // Draw diamonds
     for (auto& diamond : diamonds) {
-        diamond->Draw();
+        diamond.Draw();
     }
 }
 
 void Level::CheckCollisions(Player& player) {
     // Check diamond collisions
     for (auto& diamond : diamonds) {
-        if (!diamond->IsCollected() && CheckCollisionRecs(player.GetBounds(), diamond->GetBounds())) {
-            diamond->Collect();
+        if (!diamond.IsCollected() && CheckCollisionRecs(player.GetBounds(), diamond.GetBounds())) {
+            diamond.Collect();
             player.CollectDiamond();
         }
     }
@@ -151,12 +195,159 @@ void Level::CheckCollisions(Player& player) {
 int Level::GetRemainingDiamonds() const {
     int count = 0;
     for (const auto& diamond : diamonds) {
-        if (!diamond->IsCollected()) {
+        if (!diamond.IsCollected()) {
             count++;
         }
     }
     return count;
 }
+
+void Level::Serialize(StateWriter& writer) const {
+    writer.Write(static_cast<int32_t>(levelNumber));
+    writer.Write(static_cast<int32_t>(width));
+    writer.Write(static_cast<int32_t>(height));
+    writer.Write(playerStartPosition);
+    writer.Write(exitPosition);
+    writer.Write(static_cast<uint8_t>(exitReached ? 1 : 0));
+    
+    // Tile grid as raw bytes
+    writer.WriteBytes(tiles.data(), tiles.size() * sizeof(TileType));
+    
+    // Diamonds as fixed-size records
+    writer.Write(static_cast<uint32_t>(diamonds.size()));
+    for (const auto& diamond : diamonds) {
+        writer.Write(diamond.GetSaveData());
+    }
+}
+
+bool Level::Deserialize(StateReader& reader) {
+    MemoryScope scope(MemoryTag::LEVEL);
+    int32_t savedLevelNumber, savedWidth, savedHeight;
+    Vector2 savedPlayerStart, savedExit;
+    uint8_t savedExitReached;
+    
+    if (!reader.Read(savedLevelNumber) || !reader.Read(savedWidth) || !reader.Read(savedHeight) ||
+        !reader.Read(savedPlayerStart) || !reader.Read(savedExit) || !reader.Read(savedExitReached)) {
+        return false;
+    }
+    if (savedWidth <= 0 || savedHeight <= 0) {
+        return false;
+    }
+    
+    // Validate the whole section on a copy of the reader before touching the level,
+    // a truncated state must leave the current level intact
+    size_t tileBytes = static_cast<size_t>(savedWidth) * static_cast<size_t>(savedHeight) * sizeof(TileType);
+    StateReader lookahead = reader;
+    uint32_t diamondCount = 0;
+    if (!lookahead.Skip(tileBytes) || !lookahead.Read(diamondCount) ||
+        diamondCount > lookahead.GetRemaining() / sizeof(Diamond::SaveData)) {
+        return false;
+    }
+    
+    // The kept initial state only fits a state of the same level
+    if (savedLevelNumber != levelNumber || savedWidth != width || savedHeight != height ||
+        diamondCount != pristineDiamonds.size()) {
+        hasPristineState = false;
+    }
+    
+    levelNumber = savedLevelNumber;
+    width = savedWidth;
+    height = savedHeight;
+    playerStartPosition = savedPlayerStart;
+    exitPosition = savedExit;
+    exitReached = savedExitReached != 0;
+    
+    tiles.resize(tileBytes / sizeof(TileType));
+    reader.ReadBytes(tiles.data(), tileBytes);
+    reader.Skip(sizeof(diamondCount));
+    MarkAllTilesDirty();
+    
+    // Reuse existing diamonds when the count matches (the usual case for the same level)
+    if (diamonds.size() != diamondCount) {
+        diamonds.assign(diamondCount, Diamond(0.0f, 0.0f));
+    }
+    
+    for (auto& diamond : diamonds) {
+        Diamond::SaveData data;
+        reader.Read(data);
+        diamond.ApplySaveData(data);
+    }
+    
+    return true;
+}
+
+void Level::CapturePristineState() {
+    pristineTiles.assign(tiles.begin(), tiles.end());
+    pristineDiamonds.assign(diamonds.begin(), diamonds.end());
+    
+    // Sized for every chunk up front, marking tiles during gameplay never allocates
+    size_t chunkCount = (tiles.size() + TILE_CHUNK_SIZE - 1) / TILE_CHUNK_SIZE;
+    chunkDirty.assign(chunkCount, 0);
+    dirtyChunks.clear();
+    dirtyChunks.reserve(chunkCount);
+    allTilesDirty = false;
+    hasPristineState = true;
+}
+
+void Level::MarkTileDirty(int index) {
+    if (!hasPristineState || allTilesDirty) {
+        return;
+    }
+    
+    size_t chunk = static_cast<size_t>(index) / TILE_CHUNK_SIZE;
+    if (!chunkDirty[chunk]) {
+        chunkDirty[chunk] = 1;
+        dirtyChunks.push_back(static_cast<uint32_t>(chunk));
+    }
+}
+
+void Level::MarkAllTilesDirty() {
+    allTilesDirty = hasPristineState;
+}
+
+size_t Level::Restart() {
+    if (!hasPristineState) {
+        return 0;
+    }
+    
+    size_t restored = 0;
+    if (allTilesDirty) {
+        memcpy(tiles.data(), pristineTiles.data(), tiles.size() * sizeof(TileType));
+        restored = chunkDirty.size();
+    } else {
+        for (uint32_t chunk : dirtyChunks) {
+            size_t begin = static_cast<size_t>(chunk) * TILE_CHUNK_SIZE;
+            size_t count = std::min(static_cast<size_t>(TILE_CHUNK_SIZE), tiles.size() - begin);
+            memcpy(tiles.data() + begin, pristineTiles.data() + begin, count * sizeof(TileType));
+        }
+        restored = dirtyChunks.size();
+    }
+    
+    std::fill(chunkDirty.begin(), chunkDirty.end(), 0);
+    dirtyChunks.clear();
+    allTilesDirty = false;
+    
+    // Diamonds animate every frame, the table is small enough to copy whole
+    std::copy(pristineDiamonds.begin(), pristineDiamonds.end(), diamonds.begin());
+    exitReached = false;
+    
+    return restored;
+}
+
+void Level::GetDiamondCollectedBits(uint8_t* bits) const {
+    memset(bits, 0, (diamonds.size() + 7) / 8);
+    for (size_t i = 0; i < diamonds.size(); i++) {
+        if (diamonds[i].IsCollected()) {
+            bits[i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+        }
+    }
+}
+
+void Level::SetDiamondCollectedBits(const uint8_t* bits) {
+    for (size_t i = 0; i < diamonds.size(); i++) {
+        diamonds[i].SetCollected((bits[i / 8] >> (i % 8)) & 1);
+    }
+}
                     diamonds.push_back(std::make_unique<Diamond>(posX, posY));
                     break;
                 case 'E': // Enemy
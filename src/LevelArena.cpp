@@ -0,0 +1,73 @@
+#include "LevelArena.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+
+namespace {
+    thread_local LevelArena* currentArena = nullptr;
+}
+
+LevelArena& LevelArena::GetInstance() {
+    static LevelArena instance(DEFAULT_CAPACITY);
+    return currentArena ? *currentArena : instance;
+}
+
+LevelArena::Scope::Scope(LevelArena& arena) : previous(currentArena) {
+    currentArena = &arena;
+}
+
+LevelArena::Scope::~Scope() {
+    currentArena = previous;
+}
+
+LevelArena::LevelArena(size_t capacity) : offset(0), used(0), highWaterMark(0), resetCount(0) {
+    AddChunk(capacity);
+}
+
+void LevelArena::AddChunk(size_t size) {
+    Chunk chunk;
+    chunk.data.reset(new uint8_t[size]);
+    chunk.size = size;
+    chunks.push_back(std::move(chunk));
+    offset = 0;
+}
+
+size_t LevelArena::GetCapacity() const {
+    size_t capacity = 0;
+    for (const Chunk& chunk : chunks) {
+        capacity += chunk.size;
+    }
+    return capacity;
+}
+
+void* LevelArena::Allocate(size_t size, size_t alignment) {
+    Chunk* chunk = &chunks.back();
+    uintptr_t base = reinterpret_cast<uintptr_t>(chunk->data.get());
+    size_t aligned = ((base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base;
+
+    if (aligned + size > chunk->size) {
+        // Overflow chunk: at least double the arena so repeated growth stays rare
+        AddChunk(std::max(size + alignment, GetCapacity()));
+        chunk = &chunks.back();
+        base = reinterpret_cast<uintptr_t>(chunk->data.get());
+        aligned = ((base + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base;
+    }
+
+    used += (aligned - offset) + size;
+    offset = aligned + size;
+    highWaterMark = std::max(highWaterMark, used);
+    return chunk->data.get() + aligned;
+}
+
+void LevelArena::Reset() {
+    if (chunks.size() > 1) {
+        // Fold the overflow chunks into one block big enough for the largest level so far
+        size_t capacity = GetCapacity();
+        chunks.clear();
+        AddChunk(capacity);
+        MemoryTracker::GetInstance().RecordArenaGrowth(capacity);
+    }
+
+    offset = 0;
+    used = 0;
+    resetCount++;
+}
@@ -0,0 +1,389 @@
+#include "LevelGenerator.h"
+#include "Level.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace {
+    // Per-region random stream, same generator and seeding as rprand (external/rprand.h),
+    // but with its own state so regions can be generated on any thread
+    class RandomStream {
+    public:
+        explicit RandomStream(uint64_t seed) : splitmixSeed(seed) {
+            state[0] = static_cast<uint32_t>(SplitMix64() & 0xffffffff);
+            state[1] = static_cast<uint32_t>((SplitMix64() & 0xffffffff00000000) >> 32);
+            state[2] = static_cast<uint32_t>(SplitMix64() & 0xffffffff);
+            state[3] = static_cast<uint32_t>((SplitMix64() & 0xffffffff00000000) >> 32);
+        }
+
+        // Xoshiro128**
+        uint32_t Next() {
+            const uint32_t result = RotateLeft(state[1] * 5, 7) * 9;
+            const uint32_t t = state[1] << 9;
+
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+
+            state[2] ^= t;
+            state[3] = RotateLeft(state[3], 11);
+
+            return result;
+        }
+
+        float NextFloat() {
+            return (Next() >> 8) * (1.0f / 16777216.0f);
+        }
+
+        int NextInt(int min, int max) {
+            return (max > min) ? min + static_cast<int>(Next() % static_cast<uint32_t>(max - min + 1)) : min;
+        }
+
+    private:
+        static uint32_t RotateLeft(uint32_t x, int k) {
+            return (x << k) | (x >> (32 - k));
+        }
+
+        uint64_t SplitMix64() {
+            uint64_t z = (splitmixSeed += 0x9e3779b97f4a7c15);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+            return z ^ (z >> 31);
+        }
+
+        uint64_t splitmixSeed;
+        uint32_t state[4];
+    };
+
+    // Stateless hash of the seed and a few integer coordinates
+    uint64_t Hash(uint64_t seed, uint64_t a, uint64_t b, uint64_t c) {
+        uint64_t h = seed ^ 0x9e3779b97f4a7c15;
+        for (uint64_t v : { a, b, c }) {
+            h ^= v + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+            h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9;
+            h = (h ^ (h >> 27)) * 0x94d049bb133111eb;
+            h ^= h >> 31;
+        }
+        return h;
+    }
+
+    // Smallest region worth its own hub, one that fits the hub range [x0 + 4, x1 - 5]
+    constexpr int MIN_REGION_SIZE = 16;
+
+    enum Salt : uint64_t {
+        SALT_NOISE_COARSE = 1,
+        SALT_NOISE_FINE,
+        SALT_REGION,
+        SALT_SEAM_VERTICAL,
+        SALT_SEAM_HORIZONTAL
+    };
+
+    struct Octave {
+        int spacing;
+        float weight;
+        Salt salt;
+    };
+
+    const Octave NOISE_OCTAVES[2] = {
+        { 32, 0.65f, SALT_NOISE_COARSE },
+        { 8, 0.35f, SALT_NOISE_FINE }
+    };
+
+    bool IsSolid(TileType tile) {
+        return tile == TileType::WALL || tile == TileType::DIRT || tile == TileType::BREAKABLE;
+    }
+
+    // L-shaped tunnel through diggable dirt, open cavern is left as is
+    void CarveTunnel(LevelGenerator::Output& output, int fromX, int fromY, int toX, int toY, bool horizontalFirst) {
+        auto carve = [&](int x, int y) {
+            TileType& tile = output.tiles[static_cast<size_t>(y) * output.width + x];
+            if (tile == TileType::WALL) tile = TileType::DIRT;
+        };
+
+        int stepX = (toX > fromX) ? 1 : -1;
+        int stepY = (toY > fromY) ? 1 : -1;
+        if (horizontalFirst) {
+            for (int x = fromX; x != toX; x += stepX) carve(x, fromY);
+            for (int y = fromY; y != toY; y += stepY) carve(toX, y);
+        }
+        else {
+            for (int y = fromY; y != toY; y += stepY) carve(fromX, y);
+            for (int x = fromX; x != toX; x += stepX) carve(x, toY);
+        }
+    }
+
+    struct Region {
+        int x0, y0, x1, y1;     // Cell bounds [x0, x1) x [y0, y1)
+        int rx, ry;
+    };
+
+    class RegionGenerator {
+    public:
+        RegionGenerator(const LevelGenerator::Settings& settings, LevelGenerator::Output& output)
+            : settings(settings), output(output), width(output.width), height(output.height) {
+            regionsX = GetRegionSplit(width);
+            regionsY = GetRegionSplit(height);
+            hubs.resize(regionsX * regionsY);
+            regionDiamonds.resize(regionsX * regionsY);
+        }
+
+        int GetRegionCount() const { return regionsX * regionsY; }
+        int GetHub(int regionIndex) const { return hubs[regionIndex]; }
+        const std::vector<int>& GetDiamonds(int regionIndex) const { return regionDiamonds[regionIndex]; }
+
+        Region GetRegion(int index) const {
+            Region region;
+            region.rx = index % regionsX;
+            region.ry = index / regionsX;
+            region.x0 = region.rx * LevelGenerator::REGION_SIZE;
+            region.y0 = region.ry * LevelGenerator::REGION_SIZE;
+            region.x1 = (region.rx == regionsX - 1) ? width : region.x0 + LevelGenerator::REGION_SIZE;
+            region.y1 = (region.ry == regionsY - 1) ? height : region.y0 + LevelGenerator::REGION_SIZE;
+            return region;
+        }
+
+        // Reads and writes only cells inside the region, so regions never race on a seam
+        void Generate(int index) {
+            Region region = GetRegion(index);
+            RandomStream random(Hash(settings.seed, SALT_REGION, region.rx, region.ry));
+
+            FillNoise(region);
+
+            // Hub point the region's tunnels meet at (kept inside the region, off the outer border)
+            int hubX = std::clamp(random.NextInt(region.x0 + 4, region.x1 - 5), std::max(region.x0, 1), std::min(region.x1, width - 1) - 1);
+            int hubY = std::clamp(random.NextInt(region.y0 + 4, region.y1 - 5), std::max(region.y0, 1), std::min(region.y1, height - 1) - 1);
+            hubs[index] = hubY * width + hubX;
+            output.tiles[hubs[index]] = TileType::EMPTY;
+
+            // Tunnels to the seam crossings shared with each neighbour
+            if (region.rx > 0) {
+                CarveTunnel(output, region.x0, SeamOffset(SALT_SEAM_VERTICAL, region.rx - 1, region.ry, region.y0, region.y1), hubX, hubY, true);
+            }
+            if (region.x1 < width) {
+                CarveTunnel(output, region.x1 - 1, SeamOffset(SALT_SEAM_VERTICAL, region.rx, region.ry, region.y0, region.y1), hubX, hubY, true);
+            }
+            if (region.ry > 0) {
+                CarveTunnel(output, SeamOffset(SALT_SEAM_HORIZONTAL, region.rx, region.ry - 1, region.x0, region.x1), region.y0, hubX, hubY, false);
+            }
+            if (region.y1 < height) {
+                CarveTunnel(output, SeamOffset(SALT_SEAM_HORIZONTAL, region.rx, region.ry, region.x0, region.x1), region.y1 - 1, hubX, hubY, false);
+            }
+
+            // Outer border
+            for (int y = region.y0; y < region.y1; y++) {
+                for (int x = region.x0; x < region.x1; x++) {
+                    if (x == 0 || y == 0 || x == width - 1 || y == height - 1) {
+                        output.tiles[y * width + x] = TileType::WALL;
+                    }
+                }
+            }
+
+            PlaceFeatures(region, index, random);
+        }
+
+    private:
+        // Regions along one axis, a remainder narrower than MIN_REGION_SIZE joins the last full region
+        static int GetRegionSplit(int size) {
+            int regions = size / LevelGenerator::REGION_SIZE;
+            if (regions == 0 || size % LevelGenerator::REGION_SIZE >= MIN_REGION_SIZE) {
+                regions++;
+            }
+            return regions;
+        }
+
+        // Ladders, rocks, spikes, breakable walls and diamonds
+        void PlaceFeatures(const Region& region, int index, RandomStream& random) {
+            std::vector<int>& diamonds = regionDiamonds[index];
+            TileType* tiles = output.tiles.data();
+
+            float rockLimit = settings.rockDensity;
+            float spikeLimit = rockLimit + settings.spikeDensity;
+            float diamondLimit = spikeLimit + settings.diamondDensity;
+
+            // Bottom row is skipped: the cell below it belongs to the next region
+            for (int y = region.y0; y < region.y1 - 1; y++) {
+                for (int x = region.x0; x < region.x1; x++) {
+                    int cell = y * width + x;
+                    TileType tile = tiles[cell];
+
+                    if (tile == TileType::EMPTY && cell != hubs[index]) {
+                        TileType below = tiles[cell + width];
+                        if (IsSolid(below)) {
+                            float roll = random.NextFloat();
+                            if (roll < rockLimit) tiles[cell] = TileType::ROCK;
+                            else if (roll < spikeLimit) tiles[cell] = TileType::SPIKES;
+                            else if (roll < diamondLimit) diamonds.push_back(cell);
+                        }
+                        else if (below == TileType::EMPTY && IsLedge(region, x, y) && random.NextFloat() < settings.ladderDensity) {
+                            // Ladder down to the floor of the drop
+                            for (int ly = y; ly < region.y1 - 1 && tiles[ly * width + x] == TileType::EMPTY; ly++) {
+                                tiles[ly * width + x] = TileType::LADDER;
+                            }
+                        }
+                    }
+                    else if (tile == TileType::WALL && x > region.x0 && x < region.x1 - 1 && y > region.y0 &&
+                             x > 0 && x < width - 1 && y > 0) {
+                        bool bordersCavern = tiles[cell - 1] == TileType::EMPTY || tiles[cell + 1] == TileType::EMPTY ||
+                                             tiles[cell - width] == TileType::EMPTY || tiles[cell + width] == TileType::EMPTY;
+                        if (bordersCavern && random.NextFloat() < settings.breakableDensity) {
+                            tiles[cell] = TileType::BREAKABLE;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Top of a drop with floor right next to it, where a ladder is useful
+        bool IsLedge(const Region& region, int x, int y) const {
+            const TileType* below = output.tiles.data() + static_cast<size_t>(y + 1) * width;
+            return (x > region.x0 && IsSolid(below[x - 1])) || (x < region.x1 - 1 && IsSolid(below[x + 1]));
+        }
+
+        int SeamOffset(Salt salt, int rx, int ry, int low, int high) const {
+            // Depends only on the seam, both neighbouring regions compute the same crossing
+            int range = std::max(1, high - low - 4);
+            return low + 2 + static_cast<int>(Hash(settings.seed, salt, rx, ry) % static_cast<uint64_t>(range));
+        }
+
+        void FillNoise(const Region& region) {
+            float open = settings.caveDensity;
+            float rim = settings.caveDensity + 0.05f;
+            int regionWidth = region.x1 - region.x0;
+
+            std::vector<float> noise(regionWidth);
+            std::vector<float> lattice;
+            std::vector<float> column;
+
+            // Smoothstep weights across one lattice span, per octave
+            std::vector<float> fadeTables[2];
+            for (int i = 0; i < 2; i++) {
+                int spacing = NOISE_OCTAVES[i].spacing;
+                fadeTables[i].resize(spacing);
+                for (int x = 0; x < spacing; x++) {
+                    float fx = static_cast<float>(x) / spacing;
+                    fadeTables[i][x] = fx * fx * (3.0f - 2.0f * fx);
+                }
+            }
+
+            for (int y = region.y0; y < region.y1; y++) {
+                std::fill(noise.begin(), noise.end(), 0.0f);
+
+                for (const Octave& octave : NOISE_OCTAVES) {
+                    // Lattice values interpolated down this row, then across it
+                    int lx0 = region.x0 / octave.spacing;
+                    int lx1 = (region.x1 - 1) / octave.spacing + 1;
+                    int ly = y / octave.spacing;
+                    float fy = static_cast<float>(y % octave.spacing) / octave.spacing;
+                    fy = fy * fy * (3.0f - 2.0f * fy);
+
+                    column.resize(lx1 - lx0 + 1);
+                    for (int lx = lx0; lx <= lx1; lx++) {
+                        float top = LatticeValue(octave.salt, lx, ly);
+                        float bottom = LatticeValue(octave.salt, lx, ly + 1);
+                        column[lx - lx0] = top + (bottom - top) * fy;
+                    }
+
+                    // One lattice span at a time, keeps divisions out of the per-cell loop
+                    const std::vector<float>& fade = fadeTables[&octave - NOISE_OCTAVES];
+                    for (int lx = lx0; lx < lx1; lx++) {
+                        int spanStart = lx * octave.spacing;
+                        int xBegin = std::max(spanStart, region.x0);
+                        int xEnd = std::min(spanStart + octave.spacing, region.x1);
+                        float left = octave.weight * column[lx - lx0];
+                        float delta = octave.weight * column[lx - lx0 + 1] - left;
+                        float* out = noise.data() + (xBegin - region.x0);
+                        const float* weights = fade.data() + (xBegin - spanStart);
+                        for (int i = 0; i < xEnd - xBegin; i++) {
+                            out[i] += left + delta * weights[i];
+                        }
+                    }
+                }
+
+                TileType* row = output.tiles.data() + static_cast<size_t>(y) * width;
+                for (int x = region.x0; x < region.x1; x++) {
+                    float value = noise[x - region.x0];
+                    row[x] = (value < open) ? TileType::EMPTY : (value < rim) ? TileType::DIRT : TileType::WALL;
+                }
+            }
+        }
+
+        float LatticeValue(Salt salt, int lx, int ly) const {
+            return (Hash(settings.seed, salt, static_cast<uint32_t>(lx), static_cast<uint32_t>(ly)) >> 40) * (1.0f / 16777216.0f);
+        }
+
+        const LevelGenerator::Settings& settings;
+        LevelGenerator::Output& output;
+        int width;
+        int height;
+        int regionsX;
+        int regionsY;
+        std::vector<int> hubs;
+        std::vector<std::vector<int>> regionDiamonds;
+    };
+
+    template <typename Function>
+    void ForEachRegion(int regionCount, int threadCount, Function function) {
+        std::atomic<int> nextRegion(0);
+        auto worker = [&]() {
+            for (int index = nextRegion.fetch_add(1); index < regionCount; index = nextRegion.fetch_add(1)) {
+                function(index);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (int i = 1; i < std::min(threadCount, regionCount); i++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+}
+
+LevelGenerator::Settings LevelGenerator::GetEndlessSettings(int levelNumber) {
+    Settings settings;
+    settings.seed = Hash(0x454E444C455353, static_cast<uint64_t>(levelNumber), 0, 0);
+    settings.width = std::min(48 + levelNumber * 8, MAX_SIZE);
+    settings.height = std::min(32 + levelNumber * 6, MAX_SIZE);
+    settings.spikeDensity = std::min(0.005f + levelNumber * 0.001f, 0.05f);
+    settings.rockDensity = std::min(0.02f + levelNumber * 0.002f, 0.08f);
+    return settings;
+}
+
+void LevelGenerator::Generate(const Settings& settings, Output& output) {
+    output.width = std::clamp(settings.width, MIN_SIZE, MAX_SIZE);
+    output.height = std::clamp(settings.height, MIN_SIZE, MAX_SIZE);
+    output.tiles.assign(static_cast<size_t>(output.width) * output.height, TileType::WALL);
+    output.diamondCells.clear();
+
+    int threadCount = settings.threadCount;
+    if (threadCount <= 0) {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    RegionGenerator generator(settings, output);
+    int regionCount = generator.GetRegionCount();
+
+    ForEachRegion(regionCount, threadCount, [&](int index) { generator.Generate(index); });
+
+    // Start at the first region's hub, exit at the last one's
+    output.startCell = generator.GetHub(0);
+    output.exitCell = generator.GetHub(regionCount - 1);
+    if (output.exitCell == output.startCell) {
+        // Single region: put the exit in the far corner and dig a way there
+        output.exitCell = (output.height - 2) * output.width + (output.width - 2);
+        CarveTunnel(output, output.startCell % output.width, output.startCell / output.width, output.width - 2, output.height - 2, true);
+    }
+    output.tiles[output.startCell] = TileType::EMPTY;
+    output.tiles[output.exitCell] = TileType::EXIT;
+
+    for (int index = 0; index < regionCount; index++) {
+        for (int cell : generator.GetDiamonds(index)) {
+            if (cell != output.startCell && cell != output.exitCell) {
+                output.diamondCells.push_back(cell);
+            }
+        }
+    }
+}
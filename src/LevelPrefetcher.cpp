@@ -0,0 +1,71 @@
+#include "LevelPrefetcher.h"
+#include "Level.h"
+#include "MemoryTracker.h"
+#include <chrono>
+
+LevelPrefetcher::LevelPrefetcher()
+    : arena(nullptr), level(nullptr), levelNumber(0), buildTimeMs(0.0), ready(false),
+      lastBuildTimeMs(0.0), lastTakeWaited(false), takeCount(0), waitCount(0) {
+}
+
+LevelPrefetcher::~LevelPrefetcher() {
+    Cancel();
+}
+
+void LevelPrefetcher::Start(int levelNumber, LevelArena& arena) {
+    Cancel();
+
+    this->levelNumber = levelNumber;
+    this->arena = &arena;
+    worker = std::thread(&LevelPrefetcher::Build, this);
+}
+
+void LevelPrefetcher::Build() {
+    MemoryScope scope(MemoryTag::PREFETCH);
+    auto start = std::chrono::steady_clock::now();
+
+    // The arena's previous level was destroyed before it was handed over
+    arena->Reset();
+    LevelArena::Scope arenaScope(*arena);
+    level = arena->Create<Level>(levelNumber);
+
+    buildTimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    ready.store(true, std::memory_order_release);
+}
+
+Level* LevelPrefetcher::Take(int levelNumber) {
+    if (this->levelNumber == 0 || this->levelNumber != levelNumber) {
+        return nullptr;
+    }
+
+    bool waited = !IsReady();
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    lastBuildTimeMs = buildTimeMs;
+    lastTakeWaited = waited;
+    takeCount++;
+    if (waited) {
+        waitCount++;
+    }
+
+    Level* result = level;
+    level = nullptr;
+    this->levelNumber = 0;
+    ready.store(false, std::memory_order_relaxed);
+    return result;
+}
+
+void LevelPrefetcher::Cancel() {
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    if (level) {
+        LevelArena::Deleter()(level);
+        level = nullptr;
+    }
+    levelNumber = 0;
+    ready.store(false, std::memory_order_relaxed);
+}
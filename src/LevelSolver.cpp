@@ -0,0 +1,386 @@
+#include "LevelSolver.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace {
+    const int MOVE_DX[4] = { 0, 1, 0, -1 };
+    const int MOVE_DY[4] = { -1, 0, 1, 0 };
+
+    // SplitMix64, fixed seed so hashes are reproducible between runs
+    uint64_t NextZobristKey(uint64_t& state) {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Lock-free transposition table: open addressing with linear probing, 0 marks an empty slot
+    class TranspositionTable {
+    public:
+        enum class InsertResult {
+            INSERTED,
+            PRESENT,
+            FULL        // Load limit reached, the hash was not stored
+        };
+
+        explicit TranspositionTable(size_t minCapacity) : mask(0), loadLimit(0), count(0) {
+            size_t capacity = 1024;
+            while (capacity < minCapacity) capacity <<= 1;
+            slots.reset(new std::atomic<uint64_t>[capacity]);
+            for (size_t i = 0; i < capacity; i++) slots[i].store(0, std::memory_order_relaxed);
+            mask = capacity - 1;
+            // Probe sequences get long well before the table is completely full
+            loadLimit = capacity - capacity / 4;
+        }
+
+        InsertResult Insert(uint64_t hash) {
+            uint64_t key = (hash != 0) ? hash : 1;
+            size_t index = static_cast<size_t>(key) & mask;
+
+            for (size_t probe = 0; probe <= mask; probe++) {
+                uint64_t current = slots[index].load(std::memory_order_relaxed);
+                if (current == key) return InsertResult::PRESENT;
+                if (current == 0) {
+                    if (count.load(std::memory_order_relaxed) >= loadLimit) return InsertResult::FULL;
+                    uint64_t expected = 0;
+                    if (slots[index].compare_exchange_strong(expected, key, std::memory_order_relaxed)) {
+                        count.fetch_add(1, std::memory_order_relaxed);
+                        return InsertResult::INSERTED;
+                    }
+                    if (expected == key) return InsertResult::PRESENT;
+                }
+                index = (index + 1) & mask;
+            }
+            return InsertResult::FULL;
+        }
+
+    private:
+        std::unique_ptr<std::atomic<uint64_t>[]> slots;
+        size_t mask;
+        size_t loadLimit;
+        std::atomic<size_t> count;
+    };
+}
+
+LevelSolver::LevelSolver(const Level& level)
+    : width(level.GetWidth()),
+      height(level.GetHeight()),
+      diamondCount(0),
+      rockCount(0),
+      bitCount(0),
+      stateWords(0) {
+    int cellCount = width * height;
+    const TileType* tiles = level.GetTileData();
+    baseTiles.assign(tiles, tiles + cellCount);
+    diamondBit.assign(cellCount, -1);
+    dirtBit.assign(cellCount, -1);
+    breakableBit.assign(cellCount, -1);
+
+    // Diamonds first, so the goal test only looks at the leading bits
+    for (int i = 0; i < level.GetDiamondCount(); i++) {
+        Vector2 position = level.GetDiamondPosition(i);
+        int x = static_cast<int>(position.x) / TILE_SIZE;
+        int y = static_cast<int>(position.y) / TILE_SIZE;
+        if (x >= 0 && x < width && y >= 0 && y < height && diamondBit[y * width + x] < 0) {
+            diamondBit[y * width + x] = bitCount++;
+        }
+    }
+    diamondCount = bitCount;
+
+    std::vector<uint32_t> rocks;
+    for (int cell = 0; cell < cellCount; cell++) {
+        switch (baseTiles[cell]) {
+            case TileType::DIRT:
+                dirtBit[cell] = bitCount++;
+                break;
+            case TileType::BREAKABLE:
+                breakableBit[cell] = bitCount++;
+                break;
+            case TileType::ROCK:
+                rocks.push_back(static_cast<uint32_t>(cell));
+                baseTiles[cell] = TileType::EMPTY;
+                break;
+            default:
+                break;
+        }
+    }
+    rockCount = static_cast<int>(rocks.size());
+
+    stateWords = 1 + rockCount + (bitCount + 31) / 32;
+    initialState.assign(stateWords, 0);
+
+    Vector2 start = level.GetPlayerStartPosition();
+    int startX = std::clamp(static_cast<int>(start.x) / TILE_SIZE, 0, width - 1);
+    int startY = std::clamp(static_cast<int>(start.y) / TILE_SIZE, 0, height - 1);
+    initialState[0] = static_cast<uint32_t>(startY * width + startX);
+    std::copy(rocks.begin(), rocks.end(), initialState.begin() + 1);
+
+    // A diamond under the start position is collected immediately
+    int startBit = diamondBit[initialState[0]];
+    if (startBit >= 0) {
+        initialState[1 + rockCount + startBit / 32] |= 1u << (startBit % 32);
+    }
+
+    uint64_t seed = 0x4449414D4F4E4452ull;
+    playerKeys.resize(cellCount);
+    rockKeys.resize(cellCount);
+    bitKeys.resize(bitCount);
+    for (auto& key : playerKeys) key = NextZobristKey(seed);
+    for (auto& key : rockKeys) key = NextZobristKey(seed);
+    for (auto& key : bitKeys) key = NextZobristKey(seed);
+}
+
+uint64_t LevelSolver::ComputeHash(const uint32_t* state) const {
+    uint64_t hash = playerKeys[state[0]];
+    for (int i = 0; i < rockCount; i++) {
+        hash ^= rockKeys[state[1 + i]];
+    }
+    for (int bit = 0; bit < bitCount; bit++) {
+        if (TestBit(state, bit)) hash ^= bitKeys[bit];
+    }
+    return hash;
+}
+
+bool LevelSolver::TestBit(const uint32_t* state, int bit) const {
+    return (state[1 + rockCount + bit / 32] >> (bit % 32)) & 1;
+}
+
+void LevelSolver::FlipBit(uint32_t* state, int bit, uint64_t& hash) const {
+    state[1 + rockCount + bit / 32] ^= 1u << (bit % 32);
+    hash ^= bitKeys[bit];
+}
+
+int LevelSolver::FindRock(const uint32_t* state, int cell) const {
+    const uint32_t* rocks = state + 1;
+    const uint32_t* found = std::lower_bound(rocks, rocks + rockCount, static_cast<uint32_t>(cell));
+    return (found != rocks + rockCount && *found == static_cast<uint32_t>(cell)) ? static_cast<int>(found - rocks) : -1;
+}
+
+bool LevelSolver::IsFreeCell(const uint32_t* state, int cell) const {
+    // Free for a rock to move into: walkable, nothing on it
+    TileType tile = baseTiles[cell];
+    if (tile == TileType::DIRT) {
+        if (!TestBit(state, dirtBit[cell])) return false;
+    }
+    else if (tile == TileType::BREAKABLE) {
+        if (!TestBit(state, breakableBit[cell])) return false;
+    }
+    else if (tile != TileType::EMPTY && tile != TileType::LADDER) {
+        return false;
+    }
+
+    if (diamondBit[cell] >= 0 && !TestBit(state, diamondBit[cell])) return false;
+    return FindRock(state, cell) < 0;
+}
+
+bool LevelSolver::IsGoal(const uint32_t* state) const {
+    if (baseTiles[state[0]] != TileType::EXIT) return false;
+    for (int bit = 0; bit < diamondCount; bit++) {
+        if (!TestBit(state, bit)) return false;
+    }
+    return true;
+}
+
+bool LevelSolver::ApplyMove(const uint32_t* state, uint64_t hash, Move move, uint32_t* next, uint64_t& nextHash) const {
+    int player = static_cast<int>(state[0]);
+    int dx = MOVE_DX[static_cast<int>(move)];
+    int dy = MOVE_DY[static_cast<int>(move)];
+    int x = player % width + dx;
+    int y = player / width + dy;
+    if (x < 0 || x >= width || y < 0 || y >= height) return false;
+
+    int target = y * width + x;
+    std::copy(state, state + stateWords, next);
+    nextHash = hash;
+
+    int rock = FindRock(state, target);
+    if (rock >= 0) {
+        int behindX = x + dx;
+        int behindY = y + dy;
+        if (behindX < 0 || behindX >= width || behindY < 0 || behindY >= height) return false;
+
+        int behind = behindY * width + behindX;
+        if (!IsFreeCell(state, behind)) return false;
+
+        // Move the rock and keep the rock list sorted (canonical state)
+        uint32_t* rocks = next + 1;
+        rocks[rock] = static_cast<uint32_t>(behind);
+        std::sort(rocks, rocks + rockCount);
+        nextHash ^= rockKeys[target] ^ rockKeys[behind];
+    }
+    else {
+        switch (baseTiles[target]) {
+            case TileType::WALL:
+            case TileType::SPIKES:
+                return false;
+            case TileType::BREAKABLE:
+                if (!TestBit(state, breakableBit[target])) {
+                    // Breaking costs a move, the player stays in place
+                    FlipBit(next, breakableBit[target], nextHash);
+                    return true;
+                }
+                break;
+            case TileType::DIRT:
+                if (!TestBit(state, dirtBit[target])) {
+                    FlipBit(next, dirtBit[target], nextHash);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    next[0] = static_cast<uint32_t>(target);
+    nextHash ^= playerKeys[player] ^ playerKeys[target];
+
+    if (diamondBit[target] >= 0 && !TestBit(next, diamondBit[target])) {
+        FlipBit(next, diamondBit[target], nextHash);
+    }
+
+    return true;
+}
+
+LevelSolver::Result LevelSolver::Solve(int threadCount, size_t maxStates) {
+    auto startTime = std::chrono::steady_clock::now();
+    Result result = { Status::UNSOLVABLE, 0, {}, 0, 0.0 };
+
+    if (threadCount <= 0) {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    // States are stored flat, one BFS layer after the other
+    std::vector<uint32_t> states(initialState);
+    std::vector<uint64_t> hashes(1, ComputeHash(initialState.data()));
+    std::vector<uint32_t> parents(1, 0);
+    std::vector<Move> moves(1, Move::UP);
+
+    TranspositionTable table(maxStates * 2);
+    table.Insert(hashes[0]);
+
+    struct WorkerOutput {
+        std::vector<uint32_t> states;
+        std::vector<Successor> successors;
+    };
+    std::vector<WorkerOutput> outputs(threadCount);
+
+    size_t goalIndex = SIZE_MAX;
+    if (IsGoal(initialState.data())) goalIndex = 0;
+
+    size_t layerBegin = 0;
+    size_t layerEnd = 1;
+    int depth = 0;
+
+    while (goalIndex == SIZE_MAX && layerBegin < layerEnd) {
+        if (hashes.size() >= maxStates) {
+            result.status = Status::LIMIT_REACHED;
+            break;
+        }
+
+        // Expand the current layer in parallel, chunks are handed out through an atomic cursor
+        std::atomic<size_t> cursor(layerBegin);
+        std::atomic<bool> goalFound(false);
+        std::atomic<bool> tableFull(false);
+        const size_t chunkSize = 256;
+
+        auto expand = [&](int worker) {
+            WorkerOutput& output = outputs[worker];
+            output.states.clear();
+            output.successors.clear();
+            std::vector<uint32_t> next(stateWords);
+
+            while (!goalFound.load(std::memory_order_relaxed) && !tableFull.load(std::memory_order_relaxed)) {
+                size_t begin = cursor.fetch_add(chunkSize, std::memory_order_relaxed);
+                if (begin >= layerEnd) break;
+                size_t end = std::min(begin + chunkSize, layerEnd);
+
+                for (size_t index = begin; index < end && !tableFull.load(std::memory_order_relaxed); index++) {
+                    const uint32_t* state = &states[index * stateWords];
+                    for (int m = 0; m < 4; m++) {
+                        uint64_t nextHash;
+                        if (!ApplyMove(state, hashes[index], static_cast<Move>(m), next.data(), nextHash)) continue;
+                        TranspositionTable::InsertResult inserted = table.Insert(nextHash);
+                        if (inserted == TranspositionTable::InsertResult::FULL) {
+                            // Dropping the state would make the verdict wrong, stop the search instead
+                            tableFull.store(true, std::memory_order_relaxed);
+                            break;
+                        }
+                        if (inserted == TranspositionTable::InsertResult::PRESENT) continue;
+
+                        bool isGoal = IsGoal(next.data());
+                        output.states.insert(output.states.end(), next.begin(), next.end());
+                        output.successors.push_back({ nextHash, static_cast<uint32_t>(index), static_cast<Move>(m), isGoal });
+                        if (isGoal) goalFound.store(true, std::memory_order_relaxed);
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (int worker = 1; worker < threadCount; worker++) {
+            workers.emplace_back(expand, worker);
+        }
+        expand(0);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        // Merge the next layer
+        depth++;
+        layerBegin = layerEnd;
+        for (const WorkerOutput& output : outputs) {
+            states.insert(states.end(), output.states.begin(), output.states.end());
+            for (const Successor& successor : output.successors) {
+                if (successor.isGoal && goalIndex == SIZE_MAX) goalIndex = hashes.size();
+                hashes.push_back(successor.hash);
+                parents.push_back(successor.parent);
+                moves.push_back(successor.move);
+            }
+        }
+        layerEnd = hashes.size();
+
+        // A goal found in this layer is still minimal: every state dropped was as deep as it
+        if (tableFull.load(std::memory_order_relaxed) && goalIndex == SIZE_MAX) {
+            result.status = Status::LIMIT_REACHED;
+            break;
+        }
+    }
+
+    result.statesExplored = hashes.size();
+
+    if (goalIndex != SIZE_MAX) {
+        result.status = Status::SOLVABLE;
+        result.moveCount = (goalIndex == 0) ? 0 : depth;
+        for (size_t index = goalIndex; index != 0; index = parents[index]) {
+            result.solution.push_back(moves[index]);
+        }
+        std::reverse(result.solution.begin(), result.solution.end());
+    }
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return result;
+}
+
+const char* LevelSolver::GetStatusName(Status status) {
+    switch (status) {
+        case Status::SOLVABLE:
+            return "SOLVABLE";
+        case Status::UNSOLVABLE:
+            return "UNSOLVABLE";
+        case Status::LIMIT_REACHED:
+            return "LIMIT REACHED";
+    }
+    return "UNKNOWN";
+}
+
+std::string LevelSolver::GetSolutionString(const std::vector<Move>& solution) {
+    static const char MOVE_CHARS[4] = { 'U', 'R', 'D', 'L' };
+    std::string text;
+    text.reserve(solution.size());
+    for (Move move : solution) {
+        text += MOVE_CHARS[static_cast<int>(move)];
+    }
+    return text;
+}
@@ -0,0 +1,252 @@
+#include "MemoryTracker.h"
+#include "../raylib/src/raylib.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+namespace {
+    thread_local MemoryTag currentTag = MemoryTag::UNTAGGED;
+
+    void AtomicMax(std::atomic<int64_t>& target, int64_t value) {
+        int64_t current = target.load(std::memory_order_relaxed);
+        while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+#if defined(TRACK_ALLOCATIONS)
+    // Prefix of every tracked block, keeps the returned pointer aligned for any fundamental type
+    struct alignas(std::max_align_t) BlockHeader {
+        size_t size;
+        MemoryTag tag;
+    };
+
+    void* TrackedAllocate(size_t size, bool zeroed) {
+        if (size > SIZE_MAX - sizeof(BlockHeader)) return nullptr;
+
+        void* block = zeroed ? calloc(1, sizeof(BlockHeader) + size) : malloc(sizeof(BlockHeader) + size);
+        if (!block) return nullptr;
+
+        BlockHeader* header = static_cast<BlockHeader*>(block);
+        header->size = size;
+        header->tag = currentTag;
+        MemoryTracker::GetInstance().RecordAllocation(header->tag, size);
+        return header + 1;
+    }
+
+    void TrackedFree(void* ptr) {
+        if (!ptr) return;
+
+        BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+        MemoryTracker::GetInstance().RecordFree(header->tag, header->size);
+        free(header);
+    }
+
+    void* TrackedReallocate(void* ptr, size_t size) {
+        if (!ptr) return TrackedAllocate(size, false);
+        if (size > SIZE_MAX - sizeof(BlockHeader)) return nullptr;
+
+        // The block keeps the subsystem that first allocated it
+        BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+        MemoryTag tag = header->tag;
+        size_t oldSize = header->size;
+
+        BlockHeader* moved = static_cast<BlockHeader*>(realloc(header, sizeof(BlockHeader) + size));
+        if (!moved) return nullptr;
+
+        moved->size = size;
+        MemoryTracker::GetInstance().RecordFree(tag, oldSize);
+        MemoryTracker::GetInstance().RecordAllocation(tag, size);
+        return moved + 1;
+    }
+
+    void* TrackedNew(size_t size) {
+        void* ptr = TrackedAllocate(size, false);
+        if (!ptr) throw std::bad_alloc();
+        return ptr;
+    }
+#endif
+}
+
+#if defined(TRACK_ALLOCATIONS)
+// Global operator new/delete replacements (over-aligned new/delete are left to the runtime)
+void* operator new(size_t size) { return TrackedNew(size); }
+void* operator new[](size_t size) { return TrackedNew(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size, false); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size, false); }
+void operator delete(void* ptr) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+
+// raylib allocation hooks (RL_MEMORY_HOOKS)
+extern "C" {
+    void* RLMemoryHookMalloc(size_t size) {
+        return TrackedAllocate(size, false);
+    }
+
+    void* RLMemoryHookCalloc(size_t count, size_t size) {
+        if (size != 0 && count > SIZE_MAX / size) return nullptr;
+        return TrackedAllocate(count * size, true);
+    }
+
+    void* RLMemoryHookRealloc(void* ptr, size_t size) {
+        return TrackedReallocate(ptr, size);
+    }
+
+    void RLMemoryHookFree(void* ptr) {
+        TrackedFree(ptr);
+    }
+}
+#endif
+
+MemoryTracker& MemoryTracker::GetInstance() {
+    static MemoryTracker instance;
+    return instance;
+}
+
+bool MemoryTracker::IsEnabled() {
+#if defined(TRACK_ALLOCATIONS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char* MemoryTracker::GetTagName(MemoryTag tag) {
+    switch (tag) {
+        case MemoryTag::UNTAGGED:
+            return "UNTAGGED";
+        case MemoryTag::ASSETS:
+            return "ASSETS";
+        case MemoryTag::LEVEL:
+            return "LEVEL";
+        case MemoryTag::GAME_STATE:
+            return "GAME STATE";
+        case MemoryTag::AUDIO:
+            return "AUDIO";
+        case MemoryTag::PREFETCH:
+            return "PREFETCH";
+        case MemoryTag::COUNT:
+            break;
+    }
+    return "UNKNOWN";
+}
+
+void MemoryTracker::RecordAllocation(MemoryTag tag, size_t size) {
+    TagCounters& counters = tags[static_cast<int>(tag)];
+    int64_t bytes = static_cast<int64_t>(size);
+
+    AtomicMax(counters.peakBytes, counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.frameAllocations.fetch_add(1, std::memory_order_relaxed);
+    AtomicMax(peakBytes, liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+void MemoryTracker::RecordFree(MemoryTag tag, size_t size) {
+    int64_t bytes = static_cast<int64_t>(size);
+    tags[static_cast<int>(tag)].liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void MemoryTracker::RecordArenaGrowth(size_t capacity) {
+    arenaGrowths.fetch_add(1, std::memory_order_relaxed);
+    AtomicMax(arenaCapacity, static_cast<int64_t>(capacity));
+}
+
+void MemoryTracker::BeginFrame() {
+    for (TagCounters& counters : tags) {
+        counters.frameAllocations.store(0, std::memory_order_relaxed);
+    }
+}
+
+void MemoryTracker::EndFrame(bool steadyState) {
+    uint32_t frameTotal = 0;
+    for (int i = 0; i < static_cast<int>(MemoryTag::COUNT); i++) {
+        TagCounters& counters = tags[i];
+        counters.lastFrameAllocations = counters.frameAllocations.exchange(0, std::memory_order_relaxed);
+        counters.peakFrameAllocations = std::max(counters.peakFrameAllocations, counters.lastFrameAllocations);
+
+        // Prefetch threads work off the frame loop, their allocations never stall a frame
+        if (static_cast<MemoryTag>(i) != MemoryTag::PREFETCH) {
+            frameTotal += counters.lastFrameAllocations;
+        }
+    }
+
+    lastFrameAllocations = frameTotal;
+    peakFrameAllocations = std::max(peakFrameAllocations, frameTotal);
+    frameNumber++;
+
+    if (strictMode && steadyState && frameTotal > 0 && !failed) {
+        failed = true;
+        std::cerr << "Allocation test failed: steady-state frame " << frameNumber << " made " << frameTotal << " allocations (";
+        for (int i = 0; i < static_cast<int>(MemoryTag::COUNT); i++) {
+            std::cerr << (i > 0 ? ", " : "") << GetTagName(static_cast<MemoryTag>(i)) << " " << tags[i].lastFrameAllocations;
+        }
+        std::cerr << ")" << std::endl;
+    }
+}
+
+MemoryTracker::TagStats MemoryTracker::GetStats(MemoryTag tag) const {
+    const TagCounters& counters = tags[static_cast<int>(tag)];
+    TagStats stats;
+    stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    stats.totalAllocations = counters.totalAllocations.load(std::memory_order_relaxed);
+    stats.frameAllocations = counters.lastFrameAllocations;
+    stats.peakFrameAllocations = counters.peakFrameAllocations;
+    return stats;
+}
+
+int64_t MemoryTracker::GetLiveBytes() const {
+    return liveBytes.load(std::memory_order_relaxed);
+}
+
+void MemoryTracker::DrawStats(int x, int y, int fontSize) const {
+    if (!IsEnabled()) {
+        DrawText("ALLOC: OFF", x, y, fontSize, GREEN);
+        return;
+    }
+
+    DrawText(TextFormat("ALLOC: %u/FRAME (PEAK %u)", lastFrameAllocations, peakFrameAllocations), x, y, fontSize, GREEN);
+    DrawText(TextFormat("HEAP: %.2f MB (PEAK %.2f)", GetLiveBytes() / 1048576.0, GetPeakBytes() / 1048576.0), x, y + fontSize, fontSize, GREEN);
+}
+
+void MemoryTracker::PrintReport() const {
+    // Arena growth is counted with or without the allocation hooks
+    uint32_t growths = arenaGrowths.load(std::memory_order_relaxed);
+    if (growths > 0) {
+        std::cout << "Level arena: grown " << growths << " times, largest "
+                  << arenaCapacity.load(std::memory_order_relaxed) / 1024 << " KB" << std::endl;
+    }
+
+    if (!IsEnabled()) {
+        return;
+    }
+
+    std::cout << "Memory: " << GetLiveBytes() / 1024 << " KB live, " << GetPeakBytes() / 1024 << " KB peak, "
+              << peakFrameAllocations << " allocations in the worst frame" << std::endl;
+    for (int i = 0; i < static_cast<int>(MemoryTag::COUNT); i++) {
+        TagStats stats = GetStats(static_cast<MemoryTag>(i));
+        std::cout << "  " << std::left << std::setw(12) << GetTagName(static_cast<MemoryTag>(i)) << std::right
+                  << std::setw(10) << stats.liveBytes / 1024 << " KB live"
+                  << std::setw(10) << stats.peakBytes / 1024 << " KB peak"
+                  << std::setw(10) << stats.totalAllocations << " allocations"
+                  << std::setw(6) << stats.peakFrameAllocations << " worst frame" << std::endl;
+    }
+}
+
+MemoryScope::MemoryScope(MemoryTag tag) : previousTag(currentTag) {
+    currentTag = tag;
+}
+
+MemoryScope::~MemoryScope() {
+    currentTag = previousTag;
+}
+
+MemoryTag MemoryScope::GetCurrentTag() {
+    return currentTag;
+}
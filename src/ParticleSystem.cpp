@@ -0,0 +1,183 @@
+#include "ParticleSystem.h"
+#include "../raylib/src/rlgl.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define PARTICLES_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define PARTICLES_NEON
+#endif
+
+namespace {
+    // Quads submitted per render batch limit check, must fit in RL_DEFAULT_BATCH_BUFFER_ELEMENTS
+    constexpr size_t DRAW_CHUNK = 1024;
+}
+
+// Gameplay presets: count, color, speed, lifeTime, size, gravity
+const ParticleSystem::Burst ParticleSystem::DEBRIS_DIRT = { 12, BROWN, 60.0f, 0.6f, 2.0f, 300.0f };
+const ParticleSystem::Burst ParticleSystem::DEBRIS_BREAKABLE = { 16, BEIGE, 80.0f, 0.7f, 3.0f, 300.0f };
+const ParticleSystem::Burst ParticleSystem::SPARKLE_DIAMOND = { 20, SKYBLUE, 50.0f, 0.5f, 2.0f, -20.0f };
+const ParticleSystem::Burst ParticleSystem::HIT_PLAYER = { 24, RED, 90.0f, 0.4f, 2.0f, 200.0f };
+
+ParticleSystem& ParticleSystem::GetInstance() {
+    static ParticleSystem instance(DEFAULT_CAPACITY);
+    return instance;
+}
+
+ParticleSystem::ParticleSystem(size_t capacity)
+    : capacity(capacity),
+      count(0),
+      randomState(0x9E3779B9u),
+      posX(capacity),
+      posY(capacity),
+      velX(capacity),
+      velY(capacity),
+      accY(capacity),
+      life(capacity),
+      invLifeTime(capacity),
+      size(capacity),
+      color(capacity) {
+}
+
+float ParticleSystem::RandomFloat() {
+    // xorshift32, cheaper than GetRandomValue() and good enough for debris
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return (randomState >> 8) * (1.0f / 16777216.0f);
+}
+
+void ParticleSystem::Emit(Vector2 position, const Burst& burst) {
+    // Pool exhausted: drop the rest of the burst instead of growing
+    size_t emitCount = std::min(static_cast<size_t>(std::max(burst.count, 0)), capacity - count);
+
+    for (size_t n = 0; n < emitCount; n++) {
+        size_t i = count++;
+        float angle = RandomFloat() * 2.0f * PI;
+        float speed = burst.speed * (0.3f + 0.7f * RandomFloat());
+        float lifeTime = burst.lifeTime * (0.5f + 0.5f * RandomFloat());
+
+        posX[i] = position.x;
+        posY[i] = position.y;
+        velX[i] = cosf(angle) * speed;
+        velY[i] = sinf(angle) * speed;
+        accY[i] = burst.gravity;
+        life[i] = lifeTime;
+        invLifeTime[i] = 1.0f / lifeTime;
+        size[i] = burst.size;
+        color[i] = burst.color;
+    }
+}
+
+void ParticleSystem::Update(float deltaTime) {
+    if (count == 0) return;
+
+    Integrate(deltaTime);
+    Compact();
+}
+
+void ParticleSystem::Integrate(float deltaTime) {
+    size_t i = 0;
+
+#if defined(PARTICLES_SSE2)
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    for (; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_loadu_ps(&velX[i]);
+        __m128 vy = _mm_add_ps(_mm_loadu_ps(&velY[i]), _mm_mul_ps(_mm_loadu_ps(&accY[i]), dt));
+        _mm_storeu_ps(&posX[i], _mm_add_ps(_mm_loadu_ps(&posX[i]), _mm_mul_ps(vx, dt)));
+        _mm_storeu_ps(&posY[i], _mm_add_ps(_mm_loadu_ps(&posY[i]), _mm_mul_ps(vy, dt)));
+        _mm_storeu_ps(&velY[i], vy);
+        _mm_storeu_ps(&life[i], _mm_sub_ps(_mm_loadu_ps(&life[i]), dt));
+    }
+#elif defined(PARTICLES_NEON)
+    const float32x4_t dt = vdupq_n_f32(deltaTime);
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t vx = vld1q_f32(&velX[i]);
+        float32x4_t vy = vmlaq_f32(vld1q_f32(&velY[i]), vld1q_f32(&accY[i]), dt);
+        vst1q_f32(&posX[i], vmlaq_f32(vld1q_f32(&posX[i]), vx, dt));
+        vst1q_f32(&posY[i], vmlaq_f32(vld1q_f32(&posY[i]), vy, dt));
+        vst1q_f32(&velY[i], vy);
+        vst1q_f32(&life[i], vsubq_f32(vld1q_f32(&life[i]), dt));
+    }
+#endif
+
+    // Scalar tail (or whole range when no SIMD is available)
+    for (; i < count; i++) {
+        velY[i] += accY[i] * deltaTime;
+        posX[i] += velX[i] * deltaTime;
+        posY[i] += velY[i] * deltaTime;
+        life[i] -= deltaTime;
+    }
+}
+
+void ParticleSystem::Compact() {
+    // Swap-remove: move the last live particle into each dead slot, order is not preserved
+    size_t i = 0;
+    while (i < count) {
+        if (life[i] > 0.0f) {
+            i++;
+            continue;
+        }
+
+        size_t last = --count;
+        posX[i] = posX[last];
+        posY[i] = posY[last];
+        velX[i] = velX[last];
+        velY[i] = velY[last];
+        accY[i] = accY[last];
+        life[i] = life[last];
+        invLifeTime[i] = invLifeTime[last];
+        size[i] = size[last];
+        color[i] = color[last];
+    }
+}
+
+void ParticleSystem::Draw() const {
+    if (count == 0) return;
+
+    // Particles are untextured quads drawn with the shapes texture, same as DrawRectangle()
+    Texture2D texShapes = GetShapesTexture();
+    Rectangle shapeRect = GetShapesTextureRectangle();
+    float u0 = shapeRect.x / texShapes.width;
+    float v0 = shapeRect.y / texShapes.height;
+    float u1 = (shapeRect.x + shapeRect.width) / texShapes.width;
+    float v1 = (shapeRect.y + shapeRect.height) / texShapes.height;
+
+    rlSetTexture(texShapes.id);
+    rlBegin(RL_QUADS);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        for (size_t start = 0; start < count; start += DRAW_CHUNK) {
+            size_t end = std::min(count, start + DRAW_CHUNK);
+            rlCheckRenderBatchLimit(static_cast<int>((end - start) * 4));
+
+            for (size_t i = start; i < end; i++) {
+                // Fade out over the particle lifetime
+                float fade = std::min(life[i] * invLifeTime[i], 1.0f);
+                float half = size[i] * 0.5f;
+                float x0 = posX[i] - half;
+                float y0 = posY[i] - half;
+                float x1 = posX[i] + half;
+                float y1 = posY[i] + half;
+
+                rlColor4ub(color[i].r, color[i].g, color[i].b, static_cast<unsigned char>(color[i].a * fade));
+                rlTexCoord2f(u0, v0);
+                rlVertex2f(x0, y0);
+                rlTexCoord2f(u0, v1);
+                rlVertex2f(x0, y1);
+                rlTexCoord2f(u1, v1);
+                rlVertex2f(x1, y1);
+                rlTexCoord2f(u1, v0);
+                rlVertex2f(x1, y0);
+            }
+        }
+    rlEnd();
+    rlSetTexture(0);
+}
+
+void ParticleSystem::Clear() {
+    count = 0;
+}
@@ -1,5 +1,8 @@
 #include "Player.h"
 #include "AssetManager.h"
+#include "InputQueue.h"
+#include "ParticleSystem.h"
+#include "SfxManager.h"
 #include <iostream>
 
 Player::Player(float x, float y) 
@@ -33,6 +36,22 @@ void Player::Reset(float x, float y) {
     UpdateCollider();
 }
 
+Player::SaveData Player::GetSaveData() const {
+    return { position, velocity, frameCounter, currentFrame, diamondCount, lives, state, direction };
+}
+
+void Player::ApplySaveData(const SaveData& data) {
+    position = data.position;
+    velocity = data.velocity;
+    frameCounter = data.frameCounter;
+    currentFrame = data.currentFrame;
+    diamondCount = data.diamondCount;
+    lives = data.lives;
+    state = data.state;
+    direction = data.direction;
+    UpdateCollider();
+}
+
 void Player::HandleInput() {
     // Reset velocity
     velocity = {0, 0};
@@ -40,23 +59,26 @@ void Player::HandleInput() {
     // Only process input if not trapped or in special state
     if (state == State::TRAPPED) return;
     
+    // Key state latched right before this tick
+    const InputQueue& input = InputQueue::GetInstance();
+    
     // Movement controls
-    if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) {
+    if (input.IsKeyDown(KEY_LEFT) || input.IsKeyDown(KEY_A)) {
         velocity.x = -speed;
         direction = Direction::LEFT;
         state = State::WALKING;
     }
-    else if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) {
+    else if (input.IsKeyDown(KEY_RIGHT) || input.IsKeyDown(KEY_D)) {
         velocity.x = speed;
         direction = Direction::RIGHT;
         state = State::WALKING;
     }
-    else if (IsKeyDown(KEY_UP) || IsKeyDown(KEY_W)) {
+    else if (input.IsKeyDown(KEY_UP) || input.IsKeyDown(KEY_W)) {
         velocity.y = -speed;
         direction = Direction::UP;
         state = State::WALKING;
     }
-    else if (IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_S)) {
+    else if (input.IsKeyDown(KEY_DOWN) || input.IsKeyDown(KEY_S)) {
         velocity.y = speed;
         direction = Direction::DOWN;
         state = State::WALKING;
@@ -132,6 +154,8 @@ void Player::CollectDiamond() {
 }
 
 void Player::TakeDamage() {
+    ParticleSystem::GetInstance().Emit({position.x + 8, position.y + 8}, ParticleSystem::HIT_PLAYER);
+    
     lives--;
     if (lives <= 0) {
         Die();
@@ -161,9 +185,7 @@ void Player::Respawn() {
         state = State::JUMPING;
         
         // Play jump sound
-        if (AssetManager::GetInstance().HasSound("jump")) {
-            PlaySound(AssetManager::GetInstance().GetSound("jump"));
-        }
+        SfxManager::GetInstance().Play(SfxId::JUMP, position);
     }
 }
 
@@ -332,9 +354,7 @@ void Player::OnCollideWithEnemy() {
         invincibleTime = 2.0f; // 2 seconds of invincibility
         
         // Play damage sound
-        if (AssetManager::GetInstance().HasSound("damage")) {
-            PlaySound(AssetManager::GetInstance().GetSound("damage"));
-        }
+        SfxManager::GetInstance().Play(SfxId::DAMAGE, position);
     }
 }
 
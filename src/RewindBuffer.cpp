@@ -0,0 +1,326 @@
+#include "RewindBuffer.h"
+#include "Level.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+static_assert(sizeof(TileType) == 1, "Rewind encoding expects one byte per tile");
+
+namespace {
+    // Run-length encoding used for keyframes and XOR deltas
+    //
+    // A stream of packets, each starting with a varint header (length << 1 | isRun).
+    // Run packets are followed by the repeated byte, literal packets by `length` raw bytes.
+    constexpr size_t MIN_RUN = 4;
+
+    size_t GetEncodeBound(size_t size) {
+        // Literal packets are only broken by runs that save more than the headers cost
+        return size + size / 64 + 16;
+    }
+
+    size_t RunLength(const uint8_t* data, size_t remaining) {
+        uint8_t value = data[0];
+        uint64_t pattern = value * 0x0101010101010101ull;
+        size_t length = 1;
+
+        // Word at a time: XOR deltas are mostly long zero runs
+        while (length + 8 <= remaining) {
+            uint64_t word;
+            memcpy(&word, data + length, 8);
+            if (word != pattern) break;
+            length += 8;
+        }
+        while (length < remaining && data[length] == value) length++;
+
+        return length;
+    }
+
+    void XorBytes(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t size) {
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            uint64_t wordA, wordB;
+            memcpy(&wordA, a + i, 8);
+            memcpy(&wordB, b + i, 8);
+            wordA ^= wordB;
+            memcpy(out + i, &wordA, 8);
+        }
+        for (; i < size; i++) out[i] = a[i] ^ b[i];
+    }
+
+    uint8_t* WriteHeader(uint8_t* out, size_t length, bool isRun) {
+        uint64_t header = (static_cast<uint64_t>(length) << 1) | (isRun ? 1 : 0);
+        while (header >= 0x80) {
+            *out++ = static_cast<uint8_t>(header | 0x80);
+            header >>= 7;
+        }
+        *out++ = static_cast<uint8_t>(header);
+        return out;
+    }
+
+    bool ReadHeader(const uint8_t*& in, const uint8_t* end, size_t& length, bool& isRun) {
+        uint64_t header = 0;
+        int shift = 0;
+        while (in < end && shift < 64) {
+            uint8_t byte = *in++;
+            header |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                length = static_cast<size_t>(header >> 1);
+                isRun = (header & 1) != 0;
+                return true;
+            }
+            shift += 7;
+        }
+        return false;
+    }
+
+    size_t Encode(const uint8_t* data, size_t size, uint8_t* out) {
+        uint8_t* start = out;
+        size_t literalStart = 0;
+        size_t i = 0;
+
+        while (i < size) {
+            size_t run = RunLength(data + i, size - i);
+            if (run < MIN_RUN) {
+                i += run;
+                continue;
+            }
+
+            if (i > literalStart) {
+                out = WriteHeader(out, i - literalStart, false);
+                memcpy(out, data + literalStart, i - literalStart);
+                out += i - literalStart;
+            }
+
+            out = WriteHeader(out, run, true);
+            *out++ = data[i];
+            i += run;
+            literalStart = i;
+        }
+
+        if (size > literalStart) {
+            out = WriteHeader(out, size - literalStart, false);
+            memcpy(out, data + literalStart, size - literalStart);
+            out += size - literalStart;
+        }
+
+        return static_cast<size_t>(out - start);
+    }
+
+    // Decode into `out` (applyXor == false) or XOR the decoded stream onto `out` (applyXor == true)
+    bool Decode(const uint8_t* in, size_t inSize, uint8_t* out, size_t outSize, bool applyXor) {
+        const uint8_t* end = in + inSize;
+        size_t position = 0;
+
+        while (in < end) {
+            size_t length;
+            bool isRun;
+            if (!ReadHeader(in, end, length, isRun) || length > outSize - position) return false;
+
+            if (isRun) {
+                if (in >= end) return false;
+                uint8_t value = *in++;
+                if (!applyXor) {
+                    memset(out + position, value, length);
+                }
+                else if (value != 0) {
+                    for (size_t i = 0; i < length; i++) out[position + i] ^= value;
+                }
+            }
+            else {
+                if (length > static_cast<size_t>(end - in)) return false;
+                if (!applyXor) {
+                    memcpy(out + position, in, length);
+                }
+                else {
+                    for (size_t i = 0; i < length; i++) out[position + i] ^= in[i];
+                }
+                in += length;
+            }
+            position += length;
+        }
+
+        return position == outSize;
+    }
+}
+
+RewindBuffer::RewindBuffer(float seconds, int tickRate, size_t byteBudget)
+    : tickRate(tickRate),
+      entries(static_cast<size_t>(std::max(1.0f, std::ceil(seconds * tickRate))) + 1),
+      storage(byteBudget),
+      storageHead(0),
+      oldestSeq(0),
+      nextSeq(0),
+      count(0),
+      keyframeGridSeq(UINT64_MAX),
+      oversizedWarned(false) {
+}
+
+void RewindBuffer::Clear() {
+    storageHead = 0;
+    oldestSeq = nextSeq;
+    count = 0;
+    keyframeGridSeq = UINT64_MAX;
+}
+
+size_t RewindBuffer::GetMemoryUsage() const {
+    return entries.capacity() * sizeof(Entry) + storage.capacity() + keyframeGrid.capacity() + deltaScratch.capacity();
+}
+
+size_t RewindBuffer::GetPayloadHeaderSize(uint32_t diamondCount) const {
+    return sizeof(Counters) + sizeof(Player::SaveData) + (diamondCount + 7) / 8;
+}
+
+void RewindBuffer::EvictOldestSegment() {
+    // Deltas are useless without their keyframe, so drop up to the next keyframe
+    do {
+        oldestSeq++;
+        count--;
+    } while (count > 0 && EntryAt(oldestSeq).keyframeSeq != oldestSeq);
+
+    if (count == 0) {
+        Clear();
+    }
+}
+
+uint8_t* RewindBuffer::Allocate(size_t maxSize) {
+    if (maxSize > storage.size()) return nullptr;
+
+    while (true) {
+        if (count == 0) {
+            storageHead = 0;
+            return storage.data();
+        }
+
+        size_t tail = EntryAt(oldestSeq).offset;
+        if (storageHead > tail) {
+            // Used region is [tail, head): free space at the end, then at the start
+            if (storage.size() - storageHead >= maxSize) return storage.data() + storageHead;
+            if (tail >= maxSize) {
+                storageHead = 0;
+                return storage.data();
+            }
+        }
+        else if (storageHead < tail && tail - storageHead >= maxSize) {
+            // Used region wraps around: free space is [head, tail)
+            return storage.data() + storageHead;
+        }
+
+        EvictOldestSegment();
+    }
+}
+
+void RewindBuffer::LoadKeyframeGrid(uint64_t keyframeSeq) {
+    if (keyframeGridSeq == keyframeSeq) return;
+
+    const Entry& keyframe = EntryAt(keyframeSeq);
+    size_t headerSize = GetPayloadHeaderSize(keyframe.diamondCount);
+    keyframeGrid.resize(static_cast<size_t>(keyframe.width) * keyframe.height);
+    Decode(storage.data() + keyframe.offset + headerSize, keyframe.size - headerSize, keyframeGrid.data(), keyframeGrid.size(), false);
+    keyframeGridSeq = keyframeSeq;
+}
+
+void RewindBuffer::Record(const Level& level, const Player::SaveData& player, const Counters& counters) {
+    int width = level.GetWidth();
+    int height = level.GetHeight();
+    uint32_t diamondCount = static_cast<uint32_t>(level.GetDiamondCount());
+    size_t tileCount = static_cast<size_t>(width) * height;
+    const uint8_t* tiles = reinterpret_cast<const uint8_t*>(level.GetTileData());
+
+    // A different level (or resized grid) invalidates the whole history
+    if (count > 0) {
+        const Entry& newest = EntryAt(nextSeq - 1);
+        if (newest.width != width || newest.height != height || newest.diamondCount != diamondCount) {
+            Clear();
+        }
+    }
+
+    if (count == entries.size()) {
+        EvictOldestSegment();
+    }
+
+    size_t headerSize = GetPayloadHeaderSize(diamondCount);
+    uint8_t* payload = Allocate(headerSize + GetEncodeBound(tileCount));
+    if (!payload) {
+        if (!oversizedWarned) {
+            std::cerr << "Rewind buffer too small for a " << width << "x" << height << " level" << std::endl;
+            oversizedWarned = true;
+        }
+        return;
+    }
+
+    uint64_t seq = nextSeq;
+    bool isKeyframe = (count == 0) || (seq - EntryAt(nextSeq - 1).keyframeSeq >= KEYFRAME_INTERVAL);
+
+    // Entity state, stored verbatim
+    uint8_t* out = payload;
+    memcpy(out, &counters, sizeof(Counters));
+    out += sizeof(Counters);
+    memcpy(out, &player, sizeof(Player::SaveData));
+    out += sizeof(Player::SaveData);
+    level.GetDiamondCollectedBits(out);
+    out += (diamondCount + 7) / 8;
+
+    // Tile grid: full keyframe, or XOR delta against the current keyframe
+    size_t encodedSize;
+    if (isKeyframe) {
+        encodedSize = Encode(tiles, tileCount, out);
+        keyframeGrid.assign(tiles, tiles + tileCount);
+        keyframeGridSeq = seq;
+    }
+    else {
+        LoadKeyframeGrid(EntryAt(nextSeq - 1).keyframeSeq);
+        deltaScratch.resize(tileCount);
+        XorBytes(tiles, keyframeGrid.data(), deltaScratch.data(), tileCount);
+        encodedSize = Encode(deltaScratch.data(), tileCount, out);
+    }
+
+    Entry& entry = EntryAt(seq);
+    entry.keyframeSeq = isKeyframe ? seq : EntryAt(nextSeq - 1).keyframeSeq;
+    entry.offset = static_cast<uint32_t>(payload - storage.data());
+    entry.size = static_cast<uint32_t>(headerSize + encodedSize);
+    entry.width = width;
+    entry.height = height;
+    entry.diamondCount = diamondCount;
+
+    storageHead = entry.offset + entry.size;
+    nextSeq++;
+    count++;
+}
+
+bool RewindBuffer::StepBack(Level& level, Player::SaveData& player, Counters& counters) {
+    // Keep at least one state: the one being restored
+    if (count < 2) return false;
+
+    nextSeq--;
+    count--;
+    const Entry& entry = EntryAt(nextSeq - 1);
+    storageHead = entry.offset + entry.size;
+
+    if (entry.width != level.GetWidth() || entry.height != level.GetHeight() ||
+        entry.diamondCount != static_cast<uint32_t>(level.GetDiamondCount())) {
+        Clear();
+        return false;
+    }
+
+    const uint8_t* in = storage.data() + entry.offset;
+    memcpy(&counters, in, sizeof(Counters));
+    in += sizeof(Counters);
+    memcpy(&player, in, sizeof(Player::SaveData));
+    in += sizeof(Player::SaveData);
+    level.SetDiamondCollectedBits(in);
+    in += (entry.diamondCount + 7) / 8;
+
+    // Tiles: copy the cached keyframe grid and XOR the delta on top
+    size_t tileCount = static_cast<size_t>(entry.width) * entry.height;
+    size_t encodedSize = entry.size - GetPayloadHeaderSize(entry.diamondCount);
+    uint8_t* tiles = reinterpret_cast<uint8_t*>(level.GetTileData());
+
+    LoadKeyframeGrid(entry.keyframeSeq);
+    memcpy(tiles, keyframeGrid.data(), tileCount);
+    if (entry.keyframeSeq != nextSeq - 1) {
+        Decode(in, encodedSize, tiles, tileCount, true);
+    }
+
+    return true;
+}
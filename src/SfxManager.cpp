@@ -0,0 +1,218 @@
+#include "SfxManager.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+static_assert((SfxManager::TRIGGER_QUEUE_SIZE & (SfxManager::TRIGGER_QUEUE_SIZE - 1)) == 0, "Trigger queue size must be a power of two");
+
+SfxManager& SfxManager::GetInstance() {
+    static SfxManager instance;
+    return instance;
+}
+
+SfxManager::SfxManager()
+    : voiceCount(0), activeVoices(0), sequence(0), listener{ 0, 0 }, triggerHead(0), triggerTail(0),
+      stolenCount(0), culledCount(0), droppedCount(0) {
+    for (SoundSlot& slot : sounds) {
+        slot = { false, { 0, 0, 0.0f, 0.0f }, 0 };
+    }
+}
+
+bool SfxManager::Register(SfxId id, Sound source, const Settings& settings) {
+    int index = static_cast<int>(id);
+    if (index < 0 || index >= static_cast<int>(SfxId::COUNT) || sounds[index].registered) {
+        std::cerr << "Invalid or duplicate sound effect registration: " << index << std::endl;
+        return false;
+    }
+
+    int instances = std::min(std::max(settings.maxInstances, 1), MAX_VOICES - voiceCount);
+    if (instances <= 0 || !IsSoundValid(source)) {
+        std::cerr << "Cannot register sound effect " << index << ", no voices left or invalid sound" << std::endl;
+        return false;
+    }
+
+    SoundSlot& slot = sounds[index];
+    slot.registered = true;
+    slot.settings = settings;
+    slot.settings.maxInstances = instances;
+    slot.firstVoice = voiceCount;
+
+    for (int i = 0; i < instances; i++) {
+        Voice& voice = voices[voiceCount++];
+        voice.alias = LoadSoundAlias(source);
+        voice.sound = index;
+        voice.volume = 0.0f;
+        voice.sequence = 0;
+        voice.active = false;
+    }
+
+    return true;
+}
+
+void SfxManager::Unload() {
+    for (int i = 0; i < voiceCount; i++) {
+        StopSound(voices[i].alias);
+        UnloadSoundAlias(voices[i].alias);
+    }
+    voiceCount = 0;
+    activeVoices = 0;
+
+    for (SoundSlot& slot : sounds) {
+        slot.registered = false;
+    }
+    triggerTail.store(triggerHead.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+bool SfxManager::Play(SfxId id) {
+    int index = static_cast<int>(id);
+    if (!sounds[index].registered) {
+        return false;
+    }
+
+    return Push({ index, sounds[index].settings.volume, 0.5f });
+}
+
+bool SfxManager::Play(SfxId id, Vector2 position) {
+    int index = static_cast<int>(id);
+    if (!sounds[index].registered) {
+        return false;
+    }
+
+    const Settings& settings = sounds[index].settings;
+    if (settings.maxDistance <= 0.0f) {
+        return Push({ index, settings.volume, 0.5f });
+    }
+
+    // Linear falloff to silence at maxDistance, panned by horizontal offset (pan 1.0 is full left)
+    float dx = position.x - listener.x;
+    float dy = position.y - listener.y;
+    float attenuation = 1.0f - std::sqrt(dx * dx + dy * dy) / settings.maxDistance;
+    float volume = settings.volume * attenuation;
+    if (volume < MIN_AUDIBLE_VOLUME) {
+        culledCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    float pan = std::min(std::max(0.5f - 0.5f * dx / settings.maxDistance, 0.0f), 1.0f);
+    return Push({ index, volume, pan });
+}
+
+bool SfxManager::Push(const Trigger& trigger) {
+    uint32_t head = triggerHead.load(std::memory_order_relaxed);
+    if (head - triggerTail.load(std::memory_order_acquire) >= TRIGGER_QUEUE_SIZE) {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    triggers[head & (TRIGGER_QUEUE_SIZE - 1)] = trigger;
+    triggerHead.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+void SfxManager::Update() {
+    // Retire voices that finished on their own
+    activeVoices = 0;
+    for (int i = 0; i < voiceCount; i++) {
+        Voice& voice = voices[i];
+        if (voice.active && !IsSoundPlaying(voice.alias)) {
+            voice.active = false;
+        }
+        if (voice.active) {
+            activeVoices++;
+        }
+    }
+
+    uint32_t tail = triggerTail.load(std::memory_order_relaxed);
+    uint32_t head = triggerHead.load(std::memory_order_acquire);
+    for (; tail != head; tail++) {
+        Start(triggers[tail & (TRIGGER_QUEUE_SIZE - 1)]);
+    }
+    triggerTail.store(tail, std::memory_order_release);
+}
+
+void SfxManager::Start(const Trigger& trigger) {
+    const SoundSlot& slot = sounds[trigger.sound];
+    if (!slot.registered) {
+        return;
+    }
+
+    int first = slot.firstVoice;
+    int last = first + slot.settings.maxInstances;
+    int priority = slot.settings.priority;
+
+    // A free instance of this sound, otherwise its quietest/oldest one
+    int target = -1;
+    for (int i = first; i < last; i++) {
+        if (!voices[i].active) {
+            target = i;
+            break;
+        }
+    }
+    if (target < 0) {
+        target = FindVictim(first, last, priority);
+        StopVoice(voices[target]);
+        stolenCount++;
+    }
+
+    // Global voice budget: make room by stealing from another sound
+    if (activeVoices >= MAX_ACTIVE_VOICES) {
+        int victim = FindVictim(0, voiceCount, priority);
+        if (victim < 0) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        StopVoice(voices[victim]);
+        stolenCount++;
+    }
+
+    Voice& voice = voices[target];
+    SetSoundVolume(voice.alias, trigger.volume);
+    SetSoundPan(voice.alias, trigger.pan);
+    PlaySound(voice.alias);
+
+    voice.volume = trigger.volume;
+    voice.sequence = sequence++;
+    voice.active = true;
+    activeVoices++;
+}
+
+int SfxManager::FindVictim(int first, int last, int priority) const {
+    int victim = -1;
+    for (int i = first; i < last; i++) {
+        const Voice& voice = voices[i];
+        int voicePriority = sounds[voice.sound].settings.priority;
+        if (!voice.active || voicePriority > priority) {
+            continue;
+        }
+
+        if (victim < 0) {
+            victim = i;
+            continue;
+        }
+
+        // Lowest priority, then quietest, then oldest
+        const Voice& best = voices[victim];
+        int bestPriority = sounds[best.sound].settings.priority;
+        bool better = (voicePriority != bestPriority) ? voicePriority < bestPriority
+                    : (voice.volume != best.volume) ? voice.volume < best.volume
+                    : static_cast<int32_t>(voice.sequence - best.sequence) < 0;
+        if (better) {
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+void SfxManager::StopVoice(Voice& voice) {
+    if (voice.active) {
+        StopSound(voice.alias);
+        voice.active = false;
+        activeVoices--;
+    }
+}
+
+void SfxManager::StopAll() {
+    for (int i = 0; i < voiceCount; i++) {
+        StopVoice(voices[i]);
+    }
+}
@@ -0,0 +1,221 @@
+#include "SoundCache.h"
+#include <iostream>
+
+namespace {
+    constexpr uint32_t CACHE_MAGIC = 0x4d435053;    // "SPCM"
+    constexpr uint32_t CACHE_VERSION = 1;
+
+    struct CacheHeader {
+        CacheFile::Header common;
+        uint32_t sampleRate;
+        uint32_t channels;
+        uint32_t entryCount;
+        uint32_t reserved;
+    };
+}
+
+SoundCache::SoundCache()
+    : entries(nullptr), entryCount(0), sampleRate(0), channels(0),
+      isOpen(false), isDirty(false), hitCount(0), missCount(0) {
+}
+
+SoundCache::~SoundCache() {
+    Close();
+}
+
+bool SoundCache::Open() {
+    Close();
+
+    sampleRate = GetAudioDeviceSampleRate();
+    channels = GetAudioDeviceChannels();
+    if (sampleRate == 0 || channels == 0) {
+        return false;
+    }
+
+    isOpen = true;
+    isDirty = false;
+    hitCount = 0;
+    missCount = 0;
+
+    if (!pack.Open(CACHE_PATH)) {
+        // No pack yet, everything gets cooked
+        return true;
+    }
+
+    StateReader reader(pack.GetData(), pack.GetSize());
+    CacheHeader header;
+    bool valid = CacheFile::ReadHeader(reader, CACHE_MAGIC, CACHE_VERSION, header) &&
+                 header.sampleRate == sampleRate && header.channels == channels &&
+                 static_cast<size_t>(header.entryCount) * sizeof(Entry) <= reader.GetRemaining();
+
+    if (valid) {
+        entries = reinterpret_cast<const Entry*>(pack.GetData() + sizeof(CacheHeader));
+        entryCount = header.entryCount;
+
+        // Every entry must point inside the file at an aligned offset
+        size_t frameSize = channels * sizeof(float);
+        for (uint32_t i = 0; i < entryCount && valid; i++) {
+            const Entry& entry = entries[i];
+            valid = entry.dataOffset % CacheFile::DATA_ALIGNMENT == 0 && entry.dataOffset <= pack.GetSize() &&
+                    static_cast<uint64_t>(entry.frameCount) * frameSize <= pack.GetSize() - entry.dataOffset;
+        }
+    }
+
+    if (!valid) {
+        // Other device format or damaged file, rebuilt on Close()
+        std::cout << "Sound cache " << CACHE_PATH << " does not match the audio device, rebuilding" << std::endl;
+        entries = nullptr;
+        entryCount = 0;
+        pack.Close();
+        isDirty = true;
+    }
+
+    return true;
+}
+
+void SoundCache::Close() {
+    if (!isOpen) {
+        return;
+    }
+
+    if (isDirty) {
+        WritePack();
+    }
+
+    pack.Close();
+    entries = nullptr;
+    entryCount = 0;
+    sessionSounds.clear();
+    isOpen = false;
+    isDirty = false;
+}
+
+const SoundCache::Entry* SoundCache::FindEntry(uint64_t pathHash) const {
+    for (uint32_t i = 0; i < entryCount; i++) {
+        if (entries[i].source.pathHash == pathHash) {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+
+Sound SoundCache::LoadSound(const std::string& filePath) {
+    if (!isOpen) {
+        return ::LoadSound(filePath.c_str());
+    }
+
+    PackedSound packed;
+    packed.entry.source = CacheFile::GetSourceStamp(filePath);
+    packed.entry.frameCount = 0;
+    packed.entry.reserved = 0;
+    packed.entry.dataOffset = 0;
+    packed.mapped = nullptr;
+
+    const Entry* entry = FindEntry(packed.entry.source.pathHash);
+    bool hit = entry != nullptr && entry->source.Matches(packed.entry.source);
+
+    Sound sound = { 0 };
+    if (hit) {
+        // Already in the device format, LoadSoundFromWave only copies
+        packed.entry.frameCount = entry->frameCount;
+        packed.mapped = reinterpret_cast<const float*>(pack.GetData() + entry->dataOffset);
+
+        Wave wave = { entry->frameCount, sampleRate, 32, channels, const_cast<float*>(packed.mapped) };
+        sound = LoadSoundFromWave(wave);
+        hitCount++;
+    } else {
+        Wave wave = LoadWave(filePath.c_str());
+        if (!IsWaveValid(wave)) {
+            return sound;
+        }
+
+        // Same ma_convert_frames conversion LoadSoundFromWave would apply
+        WaveFormat(&wave, static_cast<int>(sampleRate), 32, static_cast<int>(channels));
+        if (wave.sampleSize != 32 || wave.sampleRate != sampleRate || wave.channels != channels) {
+            // Conversion failed, load uncached
+            sound = LoadSoundFromWave(wave);
+            UnloadWave(wave);
+            return sound;
+        }
+
+        sound = LoadSoundFromWave(wave);
+
+        const float* samples = static_cast<const float*>(wave.data);
+        packed.entry.frameCount = wave.frameCount;
+        packed.cooked.assign(samples, samples + static_cast<size_t>(wave.frameCount) * channels);
+        UnloadWave(wave);
+
+        missCount++;
+        isDirty = true;
+    }
+
+    // Replace an earlier load of the same file
+    for (auto it = sessionSounds.begin(); it != sessionSounds.end(); ++it) {
+        if (it->entry.source.pathHash == packed.entry.source.pathHash) {
+            sessionSounds.erase(it);
+            break;
+        }
+    }
+    sessionSounds.push_back(std::move(packed));
+
+    return sound;
+}
+
+void SoundCache::WritePack() {
+    // Sounds from this session first, then pack entries that were not loaded this time
+    std::vector<PackedSound> output;
+    output.reserve(sessionSounds.size() + entryCount);
+    for (const PackedSound& sound : sessionSounds) {
+        PackedSound copy;
+        copy.entry = sound.entry;
+        copy.mapped = sound.cooked.empty() ? sound.mapped : sound.cooked.data();
+        output.push_back(std::move(copy));
+    }
+    for (uint32_t i = 0; i < entryCount; i++) {
+        bool reloaded = false;
+        for (const PackedSound& sound : sessionSounds) {
+            if (sound.entry.source.pathHash == entries[i].source.pathHash) {
+                reloaded = true;
+                break;
+            }
+        }
+        if (!reloaded) {
+            PackedSound copy;
+            copy.entry = entries[i];
+            copy.mapped = reinterpret_cast<const float*>(pack.GetData() + entries[i].dataOffset);
+            output.push_back(std::move(copy));
+        }
+    }
+
+    size_t frameSize = channels * sizeof(float);
+    size_t offset = sizeof(CacheHeader) + output.size() * sizeof(Entry);
+    for (PackedSound& sound : output) {
+        offset = CacheFile::AlignOffset(offset);
+        sound.entry.dataOffset = offset;
+        offset += sound.entry.frameCount * frameSize;
+    }
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(offset);
+    StateWriter writer(buffer);
+
+    CacheHeader header = { { CACHE_MAGIC, CACHE_VERSION }, sampleRate, channels, static_cast<uint32_t>(output.size()), 0 };
+    writer.Write(header);
+    for (const PackedSound& sound : output) {
+        writer.Write(sound.entry);
+    }
+    for (const PackedSound& sound : output) {
+        buffer.resize(sound.entry.dataOffset, 0);
+        writer.WriteBytes(sound.mapped, sound.entry.frameCount * frameSize);
+    }
+
+    // Release the mapping before overwriting the file it maps (required on Windows)
+    pack.Close();
+    entries = nullptr;
+    entryCount = 0;
+
+    MakeDirectory(CACHE_DIRECTORY);
+    if (!SaveFileData(CACHE_PATH, buffer.data(), static_cast<int>(buffer.size()))) {
+        std::cerr << "Failed to write sound cache: " << CACHE_PATH << std::endl;
+    }
+}
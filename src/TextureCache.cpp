@@ -0,0 +1,139 @@
+#include "TextureCache.h"
+#include "CacheFile.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace {
+    constexpr uint32_t CACHE_MAGIC = 0x43585452;    // "RTXC"
+    constexpr uint32_t CACHE_VERSION = 1;
+
+    struct CacheHeader {
+        CacheFile::Header common;
+        CacheFile::SourceStamp source;
+        int32_t width;
+        int32_t height;
+        int32_t format;
+        int32_t mipmaps;
+        uint64_t dataSize;
+    };
+
+    constexpr size_t DATA_OFFSET = CacheFile::AlignOffset(sizeof(CacheHeader));
+
+    // Size of the pixel data including every mipmap level, as rtextures lays it out
+    uint64_t GetImageDataSize(int width, int height, int format, int mipmaps) {
+        uint64_t size = 0;
+        for (int i = 0; i < mipmaps; i++) {
+            size += static_cast<uint64_t>(GetPixelDataSize(width, height, format));
+            width = (width > 1) ? width / 2 : 1;
+            height = (height > 1) ? height / 2 : 1;
+        }
+        return size;
+    }
+}
+
+Image TextureCache::LoadImage(const std::string& filePath) {
+    MappedFile file;
+    Image image = { 0 };
+    bool hit = OpenCached(filePath, file, image);
+
+    if (hit) {
+        // Callers own the returned pixels, copy them out of the mapping
+        size_t dataSize = static_cast<size_t>(GetImageDataSize(image.width, image.height, image.format, image.mipmaps));
+        void* pixels = RL_MALLOC(dataSize);
+        memcpy(pixels, image.data, dataSize);
+        image.data = pixels;
+    } else {
+        image = DecodeImage(filePath);
+    }
+
+    return image;
+}
+
+Texture2D TextureCache::LoadTexture(const std::string& filePath) {
+    MappedFile file;
+    Image image = { 0 };
+    bool hit = OpenCached(filePath, file, image);
+
+    Texture2D texture = { 0 };
+    if (hit) {
+        // Uploaded directly from the mapped pages, nothing is copied on the CPU side
+        texture = LoadTextureFromImage(image);
+        file.Close();
+    } else {
+        image = DecodeImage(filePath);
+        if (IsImageValid(image)) {
+            texture = LoadTextureFromImage(image);
+        }
+        UnloadImage(image);
+    }
+
+    return texture;
+}
+
+std::string TextureCache::GetCachePath(uint64_t pathHash) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.rtx", static_cast<unsigned long long>(pathHash));
+    return std::string(CACHE_DIRECTORY) + "/" + name;
+}
+
+bool TextureCache::OpenCached(const std::string& filePath, MappedFile& file, Image& image) {
+    CacheFile::SourceStamp source = CacheFile::GetSourceStamp(filePath);
+    if (!file.Open(GetCachePath(source.pathHash))) {
+        return false;
+    }
+
+    StateReader reader(file.GetData(), file.GetSize());
+    CacheHeader header;
+    bool valid = file.GetSize() >= DATA_OFFSET && CacheFile::ReadHeader(reader, CACHE_MAGIC, CACHE_VERSION, header) &&
+                 header.source.Matches(source) && header.width > 0 && header.height > 0 && header.mipmaps > 0 &&
+                 header.format >= PIXELFORMAT_UNCOMPRESSED_GRAYSCALE && header.format <= PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA &&
+                 header.dataSize == GetImageDataSize(header.width, header.height, header.format, header.mipmaps) &&
+                 header.dataSize <= file.GetSize() - DATA_OFFSET;
+
+    if (!valid) {
+        // Stale or damaged, rewritten after decoding
+        file.Close();
+        return false;
+    }
+
+    image.data = const_cast<uint8_t*>(file.GetData() + DATA_OFFSET);
+    image.width = header.width;
+    image.height = header.height;
+    image.mipmaps = header.mipmaps;
+    image.format = header.format;
+    return true;
+}
+
+void TextureCache::SaveToCache(const std::string& filePath, const Image& image) {
+    CacheHeader header = {};
+    header.common = { CACHE_MAGIC, CACHE_VERSION };
+    header.source = CacheFile::GetSourceStamp(filePath);
+    header.width = image.width;
+    header.height = image.height;
+    header.format = image.format;
+    header.mipmaps = image.mipmaps;
+    header.dataSize = GetImageDataSize(image.width, image.height, image.format, image.mipmaps);
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(DATA_OFFSET + header.dataSize);
+    StateWriter writer(buffer);
+    writer.Write(header);
+    buffer.resize(DATA_OFFSET, 0);
+    writer.WriteBytes(image.data, header.dataSize);
+
+    MakeDirectory(CACHE_DIRECTORY);
+    std::string cachePath = GetCachePath(header.source.pathHash);
+    if (!SaveFileData(cachePath.c_str(), buffer.data(), static_cast<int>(buffer.size()))) {
+        std::cerr << "Failed to write texture cache: " << cachePath << std::endl;
+    }
+}
+
+Image TextureCache::DecodeImage(const std::string& filePath) {
+    Image image = ::LoadImage(filePath.c_str());
+    if (IsImageValid(image)) {
+        SaveToCache(filePath, image);
+    }
+    return image;
+}
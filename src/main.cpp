@@ -1,7 +1,64 @@
 #include "Game.h"
+#include "HeadlessHost.h"
+#include "MemoryTracker.h"
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
 
-int main() {
+int main(int argc, char* argv[]) {
     Game game;
+    
+#if defined(PLATFORM_HEADLESS)
+    // raylib's frame limiter only advances the virtual clock, the other modes really sleep
+    game.GetFramePacer().SetMode(FramePacer::Mode::BUSY_WAIT);
+#endif
+    
+    // Command line: --pacing=busy|precise|low-power, --endless, --alloc-test
+    // Headless builds: --frames=N, --replay=<events.rae>, --capture=<frames.rgba>
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--pacing=busy") == 0) {
+            game.GetFramePacer().SetMode(FramePacer::Mode::BUSY_WAIT);
+        }
+        else if (strcmp(argv[i], "--pacing=precise") == 0) {
+            game.GetFramePacer().SetMode(FramePacer::Mode::PRECISE_SLEEP);
+        }
+        else if (strcmp(argv[i], "--pacing=low-power") == 0) {
+            game.GetFramePacer().SetMode(FramePacer::Mode::LOW_POWER);
+        }
+        else if (strcmp(argv[i], "--endless") == 0) {
+            game.SetEndlessMode(true);
+        }
+        else if (strcmp(argv[i], "--alloc-test") == 0) {
+            // Fail (exit code 1) on the first steady-state gameplay frame that allocates
+            if (!MemoryTracker::IsEnabled()) {
+                std::cerr << "--alloc-test needs a TRACK_ALLOCATIONS build" << std::endl;
+                return 1;
+            }
+            MemoryTracker::GetInstance().SetStrictMode(true);
+        }
+#if defined(PLATFORM_HEADLESS)
+        else if (strncmp(argv[i], "--frames=", 9) == 0) {
+            HeadlessHost::GetInstance().SetFrameLimit(static_cast<unsigned int>(strtoul(argv[i] + 9, nullptr, 10)));
+        }
+        else if (strncmp(argv[i], "--replay=", 9) == 0) {
+            if (!HeadlessHost::GetInstance().OpenReplay(argv[i] + 9)) {
+                return 1;
+            }
+        }
+        else if (strncmp(argv[i], "--capture=", 10) == 0) {
+            if (!HeadlessHost::GetInstance().OpenCapture(argv[i] + 10)) {
+                return 1;
+            }
+        }
+#endif
+    }
+    
+#if defined(PLATFORM_HEADLESS)
+    HeadlessHost::GetInstance().Start();
+#endif
     game.Run();
-    return 0;
+#if defined(PLATFORM_HEADLESS)
+    HeadlessHost::GetInstance().Stop();
+#endif
+    return MemoryTracker::GetInstance().HasFailed() ? 1 : 0;
 }
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include "../raylib/src/raylib.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Audio mixing microbenchmark
+// Plays N aliases of a generated tone at once (miniaudio's null backend when there is no sound
+// hardware) and times each device callback from just before the first voice is read to the mixed
+// output, which covers reading, converting and mixing every voice. Timing starts in the data
+// callback of a silent stream placed ahead of the voices in the mixing list, its own conversion
+// and mix (one extra voice worth) is included.
+// Usage: AudioMixBenchmark [seconds] [voices]
+
+namespace {
+    constexpr int SAMPLE_RATE = 48000;
+
+    std::chrono::steady_clock::time_point callbackStart;
+    bool callbackStarted = false;
+    std::atomic<uint64_t> totalNanoseconds(0);
+    std::atomic<uint64_t> maxNanoseconds(0);
+    std::atomic<uint64_t> totalFrames(0);
+    std::atomic<uint32_t> callbackCount(0);
+
+    // Data callback of the first tracked buffer, runs before any voice is read
+    void OnCallbackStart(void* bufferData, unsigned int frames) {
+        memset(bufferData, 0, frames * 2 * sizeof(float));
+        if (!callbackStarted) {
+            callbackStart = std::chrono::steady_clock::now();
+            callbackStarted = true;
+        }
+    }
+
+    // Runs once per device callback after all voices are mixed
+    void OnMixed(void* bufferData, unsigned int frames) {
+        (void)bufferData;
+        if (!callbackStarted) {
+            return;
+        }
+
+        uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - callbackStart).count());
+        totalNanoseconds += elapsed;
+        totalFrames += frames;
+        callbackCount++;
+        if (elapsed > maxNanoseconds) {
+            maxNanoseconds = elapsed;
+        }
+        callbackStarted = false;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int seconds = (argc > 1) ? atoi(argv[1]) : 5;
+    int voiceCount = (argc > 2) ? atoi(argv[2]) : 64;
+    if (seconds <= 0 || voiceCount <= 0) {
+        std::cerr << "Usage: AudioMixBenchmark [seconds] [voices]" << std::endl;
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    InitAudioDevice();
+    if (!IsAudioDeviceReady()) {
+        std::cerr << "Audio device not available" << std::endl;
+        return 1;
+    }
+
+    // Stereo tone long enough to outlast the run, voices never stop mid-measurement
+    unsigned int frameCount = static_cast<unsigned int>((seconds + 1) * SAMPLE_RATE);
+    std::vector<float> samples(frameCount * 2);
+    for (unsigned int i = 0; i < frameCount; i++) {
+        float value = 0.25f * std::sin(2.0f * PI * 440.0f * i / SAMPLE_RATE);
+        samples[i * 2] = value;
+        samples[i * 2 + 1] = value;
+    }
+    Wave wave = { frameCount, SAMPLE_RATE, 32, 2, samples.data() };
+
+    // Buffers are mixed in creation order, the timing stream goes first
+    AudioStream timer = LoadAudioStream(SAMPLE_RATE, 32, 2);
+    SetAudioStreamCallback(timer, OnCallbackStart);
+    Sound source = LoadSoundFromWave(wave);
+
+    // Voice 0 is the source itself, the rest are aliases
+    std::vector<Sound> voices;
+    voices.push_back(source);
+    for (int i = 1; i < voiceCount; i++) {
+        voices.push_back(LoadSoundAlias(source));
+    }
+
+    AttachAudioMixedProcessor(OnMixed);
+    PlayAudioStream(timer);
+
+    for (int i = 0; i < voiceCount; i++) {
+        SetSoundVolume(voices[i], 1.0f / voiceCount);
+        SetSoundPan(voices[i], (voiceCount > 1) ? static_cast<float>(i) / (voiceCount - 1) : 0.5f);
+        PlaySound(voices[i]);
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+
+    DetachAudioMixedProcessor(OnMixed);
+    StopAudioStream(timer);
+
+    uint32_t callbacks = callbackCount;
+    if (callbacks > 0) {
+        double averageUs = totalNanoseconds / 1000.0 / callbacks;
+        double voiceFrameNs = static_cast<double>(totalNanoseconds) / (static_cast<double>(totalFrames) * voiceCount);
+        std::cout << voiceCount << " voices, " << callbacks << " callbacks of " << totalFrames / callbacks << " frames" << std::endl;
+        std::cout << "  average " << averageUs << " us, max " << maxNanoseconds / 1000.0 << " us per callback" << std::endl;
+        std::cout << "  " << voiceFrameNs << " ns per voice frame" << std::endl;
+    } else {
+        std::cout << "No audio callbacks ran" << std::endl;
+    }
+
+    for (int i = 1; i < voiceCount; i++) {
+        UnloadSoundAlias(voices[i]);
+    }
+    UnloadSound(source);
+    UnloadAudioStream(timer);
+    CloseAudioDevice();
+
+    return (callbacks > 0) ? 0 : 1;
+}